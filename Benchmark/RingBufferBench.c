@@ -0,0 +1,925 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferBench.c
+// 	Brief 		: 	Throughput and latency benchmark of the ring buffer modes. Each run moves a fixed
+//					number of elements from the producer threads to the consumer threads and reports
+//					elements per second and the p50/p99/p99.9 latency of the push and pop calls, as
+//					one CSV line
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Built by CMake with -DRING_BUFFER_BUILD_BENCHMARK=ON
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Add the built-in lock modes
+// 	1.02  	AnhNH57  	17-10-2026 	Cache-line aligned data storage
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#ifndef _GNU_SOURCE
+	#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "RingBuffer.h"
+#include "RingBufferSPSC.h"
+#include "RingBufferMPMC.h"
+#include "RingBufferBroadcast.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// One call out of BENCH_SAMPLE_INTERVAL is timed for the latency percentiles
+#define BENCH_SAMPLE_INTERVAL		16
+
+// Maximum number of values of each swept parameter
+#define BENCH_MAX_VALUES			16
+
+// Maximum number of producer or consumer threads of a run
+#define BENCH_MAX_THREADS			64
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+struct S_BENCH_RUN;
+
+// A ring buffer mode under test
+typedef struct S_BENCH_MODE
+{
+	const char*				pcName;						// Name printed in the "mode" column
+	BOOL					bMultiProducer;				// More than one producer is allowed
+	BOOL					bMultiConsumer;				// More than one consumer is allowed
+	BOOL					bBroadcast;					// Every consumer receives every element
+	BOOL					(*Setup)(struct S_BENCH_RUN* psRun);
+	BOOL					(*Push)(struct S_BENCH_RUN* psRun, void* pvData, UINT32 uiLength);
+	UINT32					(*Pop)(struct S_BENCH_RUN* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength);
+	void					(*Cleanup)(struct S_BENCH_RUN* psRun);
+
+} SBenchMode;
+
+// One run of the benchmark
+typedef struct S_BENCH_RUN
+{
+	const SBenchMode*		psMode;						// Mode under test
+	UINT32					uiElementSize;				// Size of each element in byte
+	UINT32					uiBatch;					// Elements per push/pop call
+	UINT32					uiCapacity;					// Number of elements of the ring buffer
+	UINT32					uiProducers;				// Number of producer threads
+	UINT32					uiConsumers;				// Number of consumer threads
+	UINT64					uiElements;					// Elements pushed by all producers together
+	BOOL					bPin;						// Pin each thread to its own CPU
+
+	void*					pvRing;						// Ring buffer structure of the mode
+	void*					pvStorage;					// Data storage of the ring buffer
+	pthread_mutex_t			sMutex;						// Lock of the callbackLock baseline
+
+	_Atomic UINT64			uiPopped;					// Elements popped by all consumers together
+	_Atomic UINT32			uiReady;					// Threads ready to start
+	_Atomic BOOL			bStart;						// Set when every thread is ready
+
+} SBenchRun;
+
+// One producer or consumer thread of a run
+typedef struct S_BENCH_THREAD
+{
+	SBenchRun*				psRun;						// The run
+	pthread_t				sThread;					// Thread handle
+	UINT32					uiCpu;						// CPU the thread is pinned to
+	UINT16					uiReader;					// Broadcast reader number (consumers)
+	UINT64					uiElements;					// Elements to push (producers)
+	UINT64*					puiSamples;					// Timed call latencies in ns
+	UINT64					uiSampleCount;				// Number of latencies recorded
+	UINT64					uiSampleSize;				// Capacity of puiSamples
+
+} SBenchThread;
+
+// Values of a swept parameter
+typedef struct S_BENCH_LIST
+{
+	UINT32					auiValue[BENCH_MAX_VALUES];	// The values
+	UINT32					uiCount;					// Number of values
+
+} SBenchList;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Data storage of a ring buffer, aligned to the cache line (aligned_alloc wants a multiple of it)
+#define BENCH_ALLOC_STORAGE(szBytes)	aligned_alloc(RING_BUFFER_CACHE_LINE_SIZE, ((szBytes) + RING_BUFFER_CACHE_LINE_SIZE - 1) & ~(size_t)(RING_BUFFER_CACHE_LINE_SIZE - 1))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static BOOL		BenchMutexSetup(SBenchRun* psRun);
+static BOOL		BenchMutexPush(SBenchRun* psRun, void* pvData, UINT32 uiLength);
+static UINT32	BenchMutexPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength);
+static void		BenchMutexLock(void* pvParam);
+static void		BenchMutexUnlock(void* pvParam);
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+static BOOL		BenchTicketSetup(SBenchRun* psRun);
+static BOOL		BenchPthreadSetup(SBenchRun* psRun);
+static BOOL		BenchAdaptiveSetup(SBenchRun* psRun);
+static BOOL		BenchLockSetup(SBenchRun* psRun, BUFFER_LOCK_POLICY uiPolicy);
+#endif
+static BOOL		BenchSPSCSetup(SBenchRun* psRun);
+static BOOL		BenchSPSCPush(SBenchRun* psRun, void* pvData, UINT32 uiLength);
+static UINT32	BenchSPSCPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength);
+static BOOL		BenchMPMCSetup(SBenchRun* psRun);
+static BOOL		BenchMPMCPush(SBenchRun* psRun, void* pvData, UINT32 uiLength);
+static UINT32	BenchMPMCPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength);
+static BOOL		BenchBroadcastSetup(SBenchRun* psRun);
+static BOOL		BenchBroadcastPush(SBenchRun* psRun, void* pvData, UINT32 uiLength);
+static UINT32	BenchBroadcastPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength);
+static void		BenchCleanup(SBenchRun* psRun);
+
+static void		BenchRun(SBenchRun* psRun);
+static void*	BenchProducer(void* pvParam);
+static void*	BenchConsumer(void* pvParam);
+static void		BenchStartThread(SBenchThread* psThread, void* (*Routine)(void*));
+static void		BenchRecord(SBenchThread* psThread, UINT64 uiStart);
+static void		BenchPrintPercentiles(SBenchThread* asThread, UINT32 uiThreads);
+static UINT64	BenchNow(void);
+static int		BenchCompare(const void* pvLeft, const void* pvRight);
+static BOOL		BenchParseList(const char* pcText, SBenchList* psList);
+static BOOL		BenchParseThreads(const char* pcText, SBenchList* psProducers, SBenchList* psConsumers);
+static void		BenchUsage(const char* pcProgram);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+// The modes under test. "mutex" is the baseline: SRingBuffer behind callbackLock with a pthread mutex.
+// "ticket", "pthread" and "adaptive" are SRingBuffer with the built-in locks of RingBufferLock.h
+static const SBenchMode s_asMode[] =
+{
+	{ "mutex",		TRUE,	TRUE,	FALSE,	BenchMutexSetup,		BenchMutexPush,		BenchMutexPop,		BenchCleanup },
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+	{ "ticket",		TRUE,	TRUE,	FALSE,	BenchTicketSetup,		BenchMutexPush,		BenchMutexPop,		BenchCleanup },
+	{ "pthread",	TRUE,	TRUE,	FALSE,	BenchPthreadSetup,		BenchMutexPush,		BenchMutexPop,		BenchCleanup },
+	{ "adaptive",	TRUE,	TRUE,	FALSE,	BenchAdaptiveSetup,		BenchMutexPush,		BenchMutexPop,		BenchCleanup },
+#endif
+	{ "spsc",		FALSE,	FALSE,	FALSE,	BenchSPSCSetup,			BenchSPSCPush,		BenchSPSCPop,		BenchCleanup },
+	{ "mpmc",		TRUE,	TRUE,	FALSE,	BenchMPMCSetup,			BenchMPMCPush,		BenchMPMCPop,		BenchCleanup },
+	{ "broadcast",	FALSE,	TRUE,	TRUE,	BenchBroadcastSetup,	BenchBroadcastPush,	BenchBroadcastPop,	BenchCleanup },
+};
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Sweep the requested parameters over the requested modes and print one CSV line per run
+//
+//	@param	: 	iArgc is the number of command line arguments
+//	@param	: 	ppcArgv is the command line arguments, see BenchUsage
+//	@return	: 	0 if every run could be set up, 1 otherwise
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+int main(int iArgc, char** ppcArgv)
+{
+	SBenchList	sSizes		= { { 1, 8, 64, 256, 1024, 4096 }, 6 };
+	SBenchList	sBatches	= { { 1, 16, 64 }, 3 };
+	SBenchList	sCapacities	= { { 256, 4096 }, 2 };
+	SBenchList	sProducers	= { { 1, 2, 1 }, 3 };
+	SBenchList	sConsumers	= { { 1, 2, 4 }, 3 };
+	const char*	pcModes		= NULL;
+	SBenchRun	sRun;
+	UINT64		uiElements	= 200000;
+	BOOL		bPin		= TRUE;
+	BOOL		bResult		= TRUE;
+	int			iOption		= 0;
+	UINT32		uiMode		= 0;
+	UINT32		uiSize		= 0;
+	UINT32		uiBatch		= 0;
+	UINT32		uiCapacity	= 0;
+	UINT32		uiThreads	= 0;
+
+	while ((iOption = getopt(iArgc, ppcArgv, "m:s:b:c:t:n:uh")) != -1)
+	{
+		switch (iOption)
+		{
+			case 'm':	pcModes = optarg;												break;
+			case 's':	bResult = bResult && BenchParseList(optarg, &sSizes);			break;
+			case 'b':	bResult = bResult && BenchParseList(optarg, &sBatches);			break;
+			case 'c':	bResult = bResult && BenchParseList(optarg, &sCapacities);		break;
+			case 't':	bResult = bResult && BenchParseThreads(optarg, &sProducers, &sConsumers);	break;
+			case 'n':	uiElements = strtoull(optarg, NULL, 0);							break;
+			case 'u':	bPin = FALSE;													break;
+			default:	bResult = FALSE;												break;
+		}
+	}
+
+	if ((bResult == FALSE) || (uiElements == 0))
+	{
+		BenchUsage(ppcArgv[0]);
+		return 1;
+	}
+
+	printf("mode,element_size,batch,capacity,producers,consumers,elements,ops_per_sec,"
+		   "push_p50_ns,push_p99_ns,push_p999_ns,pop_p50_ns,pop_p99_ns,pop_p999_ns\n");
+
+	for (uiMode = 0; uiMode < sizeof(s_asMode) / sizeof(s_asMode[0]); uiMode++)
+	{
+		if ((pcModes != NULL) && (strstr(pcModes, s_asMode[uiMode].pcName) == NULL))
+		{
+			continue;
+		}
+
+		for (uiSize = 0; uiSize < sSizes.uiCount; uiSize++)
+		for (uiBatch = 0; uiBatch < sBatches.uiCount; uiBatch++)
+		for (uiCapacity = 0; uiCapacity < sCapacities.uiCount; uiCapacity++)
+		for (uiThreads = 0; uiThreads < sProducers.uiCount; uiThreads++)
+		{
+			memset(&sRun, 0, sizeof(sRun));
+			sRun.psMode			= &s_asMode[uiMode];
+			sRun.uiElementSize	= sSizes.auiValue[uiSize];
+			sRun.uiBatch		= sBatches.auiValue[uiBatch];
+			sRun.uiCapacity		= sCapacities.auiValue[uiCapacity];
+			sRun.uiProducers	= sProducers.auiValue[uiThreads];
+			sRun.uiConsumers	= sConsumers.auiValue[uiThreads];
+			sRun.uiElements		= uiElements;
+			sRun.bPin			= bPin;
+
+			// Skip the combinations the mode cannot run
+			if ((sRun.uiBatch > sRun.uiCapacity) ||
+				((sRun.uiProducers > 1) && (sRun.psMode->bMultiProducer == FALSE)) ||
+				((sRun.uiConsumers > 1) && (sRun.psMode->bMultiConsumer == FALSE)))
+			{
+				continue;
+			}
+
+			if (sRun.psMode->Setup(&sRun) == FALSE)
+			{
+				fprintf(stderr, "%s: cannot set up capacity %lu, element size %lu\n", sRun.psMode->pcName, sRun.uiCapacity, sRun.uiElementSize);
+				bResult = FALSE;
+				continue;
+			}
+
+			BenchRun(&sRun);
+			sRun.psMode->Cleanup(&sRun);
+		}
+	}
+
+	return (bResult == TRUE) ? 0 : 1;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Set up the callbackLock baseline: SRingBuffer locked by a pthread mutex
+//
+//	@param	: 	psRun is the run
+//	@return	: 	TRUE if setting up successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL BenchMutexSetup(SBenchRun* psRun)
+{
+	if ((psRun->uiCapacity > (BUFFER_INDEX)~(BUFFER_INDEX)0) || (psRun->uiElementSize > 0xFFFF))
+	{
+		return FALSE;
+	}
+
+	psRun->pvRing		= calloc(1, sizeof(SRingBuffer));
+	psRun->pvStorage	= BENCH_ALLOC_STORAGE((size_t)psRun->uiCapacity * psRun->uiElementSize);
+	if ((psRun->pvRing == NULL) || (psRun->pvStorage == NULL))
+	{
+		return FALSE;
+	}
+
+	pthread_mutex_init(&psRun->sMutex, NULL);
+	BufferInit((SRingBuffer*)psRun->pvRing, psRun->pvStorage, psRun->uiCapacity, psRun->uiElementSize, BenchMutexLock, BenchMutexUnlock, &psRun->sMutex);
+
+	return TRUE;
+}
+
+static BOOL BenchMutexPush(SBenchRun* psRun, void* pvData, UINT32 uiLength)
+{
+	if (uiLength == 1)
+	{
+		return BufferPush((SRingBuffer*)psRun->pvRing, pvData);
+	}
+
+	return BufferPushStream((SRingBuffer*)psRun->pvRing, pvData, uiLength);
+}
+
+static UINT32 BenchMutexPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength)
+{
+	(void)uiReader;
+
+	if (uiLength == 1)
+	{
+		return BufferPop((SRingBuffer*)psRun->pvRing, pvData);
+	}
+
+	return BufferPopStream((SRingBuffer*)psRun->pvRing, pvData, uiLength);
+}
+
+static void BenchMutexLock(void* pvParam)
+{
+	pthread_mutex_lock((pthread_mutex_t*)pvParam);
+}
+
+static void BenchMutexUnlock(void* pvParam)
+{
+	pthread_mutex_unlock((pthread_mutex_t*)pvParam);
+}
+
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+
+static BOOL BenchTicketSetup(SBenchRun* psRun)
+{
+	return BenchLockSetup(psRun, BUFFER_LOCK_TICKET);
+}
+
+static BOOL BenchPthreadSetup(SBenchRun* psRun)
+{
+	return BenchLockSetup(psRun, BUFFER_LOCK_MUTEX);
+}
+
+static BOOL BenchAdaptiveSetup(SBenchRun* psRun)
+{
+	return BenchLockSetup(psRun, BUFFER_LOCK_ADAPTIVE);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Set up SRingBuffer with a built-in lock
+//
+//	@param	: 	psRun is the run
+//	@param	: 	uiPolicy is the lock, one of BUFFER_LOCK_xxx
+//	@return	: 	TRUE if setting up successfully and vice versa
+//	@note	:	Pushed and popped by BenchMutexPush/BenchMutexPop like the baseline
+// ---------------------------------------------------------------------------------------------------
+static BOOL BenchLockSetup(SBenchRun* psRun, BUFFER_LOCK_POLICY uiPolicy)
+{
+	if ((psRun->uiCapacity > (BUFFER_INDEX)~(BUFFER_INDEX)0) || (psRun->uiElementSize > 0xFFFF))
+	{
+		return FALSE;
+	}
+
+	psRun->pvRing		= calloc(1, sizeof(SRingBuffer));
+	psRun->pvStorage	= BENCH_ALLOC_STORAGE((size_t)psRun->uiCapacity * psRun->uiElementSize);
+	if ((psRun->pvRing == NULL) || (psRun->pvStorage == NULL))
+	{
+		return FALSE;
+	}
+
+	return BufferInitWithLock((SRingBuffer*)psRun->pvRing, psRun->pvStorage, psRun->uiCapacity, psRun->uiElementSize, uiPolicy);
+}
+
+#endif
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Set up the lock-free single-producer/single-consumer mode
+//
+//	@param	: 	psRun is the run
+//	@return	: 	TRUE if setting up successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL BenchSPSCSetup(SBenchRun* psRun)
+{
+	if ((psRun->uiCapacity > 0x7FFF) || (psRun->uiElementSize > 0xFFFF))
+	{
+		return FALSE;
+	}
+
+	psRun->pvRing		= aligned_alloc(RING_BUFFER_CACHE_LINE_SIZE, sizeof(SRingBufferSPSC));
+	psRun->pvStorage	= BENCH_ALLOC_STORAGE((size_t)psRun->uiCapacity * psRun->uiElementSize);
+	if ((psRun->pvRing == NULL) || (psRun->pvStorage == NULL))
+	{
+		return FALSE;
+	}
+
+	BufferSPSCInit((SRingBufferSPSC*)psRun->pvRing, psRun->pvStorage, psRun->uiCapacity, psRun->uiElementSize);
+
+	return TRUE;
+}
+
+static BOOL BenchSPSCPush(SBenchRun* psRun, void* pvData, UINT32 uiLength)
+{
+	if (uiLength == 1)
+	{
+		return BufferSPSCPush((SRingBufferSPSC*)psRun->pvRing, pvData);
+	}
+
+	return BufferSPSCPushStream((SRingBufferSPSC*)psRun->pvRing, pvData, uiLength);
+}
+
+static UINT32 BenchSPSCPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength)
+{
+	(void)uiReader;
+
+	if (uiLength == 1)
+	{
+		return BufferSPSCPop((SRingBufferSPSC*)psRun->pvRing, pvData);
+	}
+
+	return BufferSPSCPopStream((SRingBufferSPSC*)psRun->pvRing, pvData, uiLength);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Set up the lock-free multi-producer/multi-consumer mode
+//
+//	@param	: 	psRun is the run
+//	@return	: 	TRUE if setting up successfully and vice versa
+//	@note	:	The capacity must be a power of two
+// ---------------------------------------------------------------------------------------------------
+static BOOL BenchMPMCSetup(SBenchRun* psRun)
+{
+	if ((psRun->uiCapacity > 0x8000) || (psRun->uiElementSize > 0xFFFF))
+	{
+		return FALSE;
+	}
+
+	psRun->pvRing		= aligned_alloc(RING_BUFFER_CACHE_LINE_SIZE, sizeof(SRingBufferMPMC));
+	psRun->pvStorage	= BENCH_ALLOC_STORAGE(BUFFER_MPMC_STORAGE_SIZE((size_t)psRun->uiCapacity, psRun->uiElementSize));
+	if ((psRun->pvRing == NULL) || (psRun->pvStorage == NULL))
+	{
+		return FALSE;
+	}
+
+	return BufferMPMCInit((SRingBufferMPMC*)psRun->pvRing, psRun->pvStorage, psRun->uiCapacity, psRun->uiElementSize);
+}
+
+static BOOL BenchMPMCPush(SBenchRun* psRun, void* pvData, UINT32 uiLength)
+{
+	if (uiLength == 1)
+	{
+		return BufferMPMCPush((SRingBufferMPMC*)psRun->pvRing, pvData);
+	}
+
+	return BufferMPMCPushStream((SRingBufferMPMC*)psRun->pvRing, pvData, uiLength);
+}
+
+static UINT32 BenchMPMCPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength)
+{
+	(void)uiReader;
+
+	if (uiLength == 1)
+	{
+		return BufferMPMCPop((SRingBufferMPMC*)psRun->pvRing, pvData);
+	}
+
+	return BufferMPMCPopStream((SRingBufferMPMC*)psRun->pvRing, pvData, uiLength);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Set up the broadcast mode, every consumer joins before the producer starts
+//
+//	@param	: 	psRun is the run
+//	@return	: 	TRUE if setting up successfully and vice versa
+//	@note	:	The capacity must be a power of two
+// ---------------------------------------------------------------------------------------------------
+static BOOL BenchBroadcastSetup(SBenchRun* psRun)
+{
+	if ((psRun->uiCapacity > 0x8000) || (psRun->uiElementSize > 0xFFFF) || (psRun->uiConsumers > RING_BUFFER_BROADCAST_READERS))
+	{
+		return FALSE;
+	}
+
+	psRun->pvRing		= aligned_alloc(RING_BUFFER_CACHE_LINE_SIZE, sizeof(SRingBufferBroadcast));
+	psRun->pvStorage	= BENCH_ALLOC_STORAGE((size_t)psRun->uiCapacity * psRun->uiElementSize);
+	if ((psRun->pvRing == NULL) || (psRun->pvStorage == NULL))
+	{
+		return FALSE;
+	}
+
+	return BufferBroadcastInit((SRingBufferBroadcast*)psRun->pvRing, psRun->pvStorage, psRun->uiCapacity, psRun->uiElementSize);
+}
+
+static BOOL BenchBroadcastPush(SBenchRun* psRun, void* pvData, UINT32 uiLength)
+{
+	return BufferBroadcastPushStream((SRingBufferBroadcast*)psRun->pvRing, pvData, uiLength);
+}
+
+static UINT32 BenchBroadcastPop(SBenchRun* psRun, UINT16 uiReader, void* pvData, UINT32 uiLength)
+{
+	return BufferBroadcastPopStream((SRingBufferBroadcast*)psRun->pvRing, uiReader, pvData, uiLength);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the ring buffer of a run
+//
+//	@param	: 	psRun is the run
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BenchCleanup(SBenchRun* psRun)
+{
+	if (psRun->psMode->Setup == BenchMutexSetup)
+	{
+		pthread_mutex_destroy(&psRun->sMutex);
+	}
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+	else if (psRun->psMode->Push == BenchMutexPush)
+	{
+		BufferDeinit((SRingBuffer*)psRun->pvRing);
+	}
+#endif
+
+	free(psRun->pvRing);
+	free(psRun->pvStorage);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Run the producer and consumer threads of a run and print its CSV line
+//
+//	@param	: 	psRun is the run, already set up
+//	@return	: 	Void
+//	@note	:	The clock starts when every thread is ready and stops when every element is popped
+// ---------------------------------------------------------------------------------------------------
+static void BenchRun(SBenchRun* psRun)
+{
+	SBenchThread	asProducer[BENCH_MAX_THREADS];
+	SBenchThread	asConsumer[BENCH_MAX_THREADS];
+	UINT64			uiCalls		= 0;
+	UINT64			uiStart		= 0;
+	UINT64			uiStop		= 0;
+	UINT32			uiIndex		= 0;
+	long			lCpus		= sysconf(_SC_NPROCESSORS_ONLN);
+
+	memset(asProducer, 0, sizeof(asProducer));
+	memset(asConsumer, 0, sizeof(asConsumer));
+	atomic_init(&psRun->uiPopped, 0);
+	atomic_init(&psRun->uiReady, 0);
+	atomic_init(&psRun->bStart, FALSE);
+
+	if (lCpus <= 0)
+	{
+		lCpus = 1;
+	}
+
+	for (uiIndex = 0; uiIndex < psRun->uiConsumers; uiIndex++)
+	{
+		asConsumer[uiIndex].psRun	= psRun;
+		asConsumer[uiIndex].uiCpu	= (psRun->uiProducers + uiIndex) % lCpus;
+		uiCalls = psRun->uiElements / psRun->uiBatch + 1;
+		if (psRun->psMode->bBroadcast == TRUE)
+		{
+			BufferBroadcastJoin((SRingBufferBroadcast*)psRun->pvRing, &asConsumer[uiIndex].uiReader);
+		}
+		else
+		{
+			uiCalls = uiCalls / psRun->uiConsumers + 1;
+		}
+
+		// Failed calls are not timed, so this is enough for every timed call
+		asConsumer[uiIndex].uiSampleSize	= uiCalls / BENCH_SAMPLE_INTERVAL + psRun->uiBatch + 1;
+		asConsumer[uiIndex].puiSamples		= malloc(asConsumer[uiIndex].uiSampleSize * sizeof(UINT64));
+		BenchStartThread(&asConsumer[uiIndex], BenchConsumer);
+	}
+
+	for (uiIndex = 0; uiIndex < psRun->uiProducers; uiIndex++)
+	{
+		asProducer[uiIndex].psRun		= psRun;
+		asProducer[uiIndex].uiCpu		= uiIndex % lCpus;
+		asProducer[uiIndex].uiElements	= psRun->uiElements / psRun->uiProducers;
+		if (uiIndex == 0)
+		{
+			asProducer[uiIndex].uiElements += psRun->uiElements % psRun->uiProducers;
+		}
+
+		asProducer[uiIndex].uiSampleSize	= asProducer[uiIndex].uiElements / psRun->uiBatch / BENCH_SAMPLE_INTERVAL + 2;
+		asProducer[uiIndex].puiSamples		= malloc(asProducer[uiIndex].uiSampleSize * sizeof(UINT64));
+		BenchStartThread(&asProducer[uiIndex], BenchProducer);
+	}
+
+	// Start every thread at once
+	while (atomic_load(&psRun->uiReady) < psRun->uiProducers + psRun->uiConsumers)
+	{
+		sched_yield();
+	}
+
+	uiStart = BenchNow();
+	atomic_store(&psRun->bStart, TRUE);
+
+	for (uiIndex = 0; uiIndex < psRun->uiProducers; uiIndex++)
+	{
+		pthread_join(asProducer[uiIndex].sThread, NULL);
+	}
+
+	for (uiIndex = 0; uiIndex < psRun->uiConsumers; uiIndex++)
+	{
+		pthread_join(asConsumer[uiIndex].sThread, NULL);
+	}
+
+	uiStop = BenchNow();
+
+	printf("%s,%lu,%lu,%lu,%lu,%lu,%llu,%.0f",
+		   psRun->psMode->pcName,
+		   psRun->uiElementSize,
+		   psRun->uiBatch,
+		   psRun->uiCapacity,
+		   psRun->uiProducers,
+		   psRun->uiConsumers,
+		   psRun->uiElements,
+		   (double)psRun->uiElements * 1e9 / (double)(uiStop - uiStart));
+	BenchPrintPercentiles(asProducer, psRun->uiProducers);
+	BenchPrintPercentiles(asConsumer, psRun->uiConsumers);
+	printf("\n");
+	fflush(stdout);
+
+	for (uiIndex = 0; uiIndex < BENCH_MAX_THREADS; uiIndex++)
+	{
+		free(asProducer[uiIndex].puiSamples);
+		free(asConsumer[uiIndex].puiSamples);
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Producer thread: push its share of the elements, uiBatch at a time
+//
+//	@param	: 	pvParam is the SBenchThread of the producer
+//	@return	: 	NULL
+//	@note	:	A full buffer makes the producer yield and retry, the failed call is not timed
+// ---------------------------------------------------------------------------------------------------
+static void* BenchProducer(void* pvParam)
+{
+	SBenchThread*	psThread	= (SBenchThread*)pvParam;
+	SBenchRun*		psRun		= psThread->psRun;
+	UCHAR*			pucData		= calloc(psRun->uiBatch, psRun->uiElementSize);
+	UINT64			uiLeft		= psThread->uiElements;
+	UINT64			uiCall		= 0;
+	UINT64			uiStart		= 0;
+	UINT32			uiLength	= 0;
+	BOOL			bTimed		= FALSE;
+
+	atomic_fetch_add(&psRun->uiReady, 1);
+	while (atomic_load_explicit(&psRun->bStart, memory_order_acquire) == FALSE)
+	{
+		sched_yield();
+	}
+
+	while (uiLeft > 0)
+	{
+		uiLength	= (uiLeft < psRun->uiBatch) ? (UINT32)uiLeft : psRun->uiBatch;
+		bTimed		= ((uiCall % BENCH_SAMPLE_INTERVAL) == 0);
+		uiStart		= bTimed ? BenchNow() : 0;
+
+		if (psRun->psMode->Push(psRun, pucData, uiLength) == TRUE)
+		{
+			if (bTimed)
+			{
+				BenchRecord(psThread, uiStart);
+			}
+			uiLeft -= uiLength;
+			uiCall++;
+		}
+		else
+		{
+			sched_yield();
+		}
+	}
+
+	free(pucData);
+
+	return NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Consumer thread: pop until every element is popped (or, in broadcast mode, until it
+//				has read every element itself)
+//
+//	@param	: 	pvParam is the SBenchThread of the consumer
+//	@return	: 	NULL
+//	@note	:	An empty buffer makes the consumer yield and retry, the failed call is not timed
+// ---------------------------------------------------------------------------------------------------
+static void* BenchConsumer(void* pvParam)
+{
+	SBenchThread*	psThread	= (SBenchThread*)pvParam;
+	SBenchRun*		psRun		= psThread->psRun;
+	UCHAR*			pucData		= calloc(psRun->uiBatch, psRun->uiElementSize);
+	UINT64			uiOwn		= 0;
+	UINT64			uiCall		= 0;
+	UINT64			uiStart		= 0;
+	UINT32			uiLength	= 0;
+	BOOL			bTimed		= FALSE;
+
+	atomic_fetch_add(&psRun->uiReady, 1);
+	while (atomic_load_explicit(&psRun->bStart, memory_order_acquire) == FALSE)
+	{
+		sched_yield();
+	}
+
+	for (;;)
+	{
+		if (psRun->psMode->bBroadcast == TRUE)
+		{
+			if (uiOwn >= psRun->uiElements)
+			{
+				break;
+			}
+		}
+		else if (atomic_load_explicit(&psRun->uiPopped, memory_order_relaxed) >= psRun->uiElements)
+		{
+			break;
+		}
+
+		bTimed		= ((uiCall % BENCH_SAMPLE_INTERVAL) == 0);
+		uiStart		= bTimed ? BenchNow() : 0;
+		uiLength	= psRun->psMode->Pop(psRun, psThread->uiReader, pucData, psRun->uiBatch);
+
+		if (uiLength > 0)
+		{
+			if (bTimed && (psThread->uiSampleCount < psThread->uiSampleSize))
+			{
+				BenchRecord(psThread, uiStart);
+			}
+			uiOwn += uiLength;
+			atomic_fetch_add_explicit(&psRun->uiPopped, uiLength, memory_order_relaxed);
+			uiCall++;
+		}
+		else
+		{
+			sched_yield();
+		}
+	}
+
+	free(pucData);
+
+	return NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Create a thread of a run
+//
+//	@param	: 	psThread is the thread, pinned to psThread->uiCpu if the run asks for it
+//	@param	: 	Routine is BenchProducer or BenchConsumer
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BenchStartThread(SBenchThread* psThread, void* (*Routine)(void*))
+{
+	pthread_attr_t	sAttr;
+	cpu_set_t		sCpus;
+
+	pthread_attr_init(&sAttr);
+	if (psThread->psRun->bPin == TRUE)
+	{
+		CPU_ZERO(&sCpus);
+		CPU_SET(psThread->uiCpu, &sCpus);
+		pthread_attr_setaffinity_np(&sAttr, sizeof(sCpus), &sCpus);
+	}
+
+	if (pthread_create(&psThread->sThread, &sAttr, Routine, psThread) != 0)
+	{
+		perror("pthread_create");
+		exit(1);
+	}
+
+	pthread_attr_destroy(&sAttr);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Record the latency of a timed call
+//
+//	@param	: 	psThread is the thread
+//	@param	: 	uiStart is the time the call started
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BenchRecord(SBenchThread* psThread, UINT64 uiStart)
+{
+	if (psThread->uiSampleCount < psThread->uiSampleSize)
+	{
+		psThread->puiSamples[psThread->uiSampleCount++] = BenchNow() - uiStart;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Print the p50, p99 and p99.9 latencies of a group of threads as three CSV columns
+//
+//	@param	: 	asThread is the threads
+//	@param	: 	uiThreads is the number of threads
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BenchPrintPercentiles(SBenchThread* asThread, UINT32 uiThreads)
+{
+	static const double	adPercentile[] = { 0.50, 0.99, 0.999 };
+	UINT64*				puiAll		= NULL;
+	UINT64				uiCount		= 0;
+	UINT32				uiIndex		= 0;
+
+	for (uiIndex = 0; uiIndex < uiThreads; uiIndex++)
+	{
+		uiCount += asThread[uiIndex].uiSampleCount;
+	}
+
+	puiAll = malloc((uiCount + 1) * sizeof(UINT64));
+	uiCount = 0;
+	for (uiIndex = 0; uiIndex < uiThreads; uiIndex++)
+	{
+		memcpy(puiAll + uiCount, asThread[uiIndex].puiSamples, asThread[uiIndex].uiSampleCount * sizeof(UINT64));
+		uiCount += asThread[uiIndex].uiSampleCount;
+	}
+
+	qsort(puiAll, uiCount, sizeof(UINT64), BenchCompare);
+
+	for (uiIndex = 0; uiIndex < sizeof(adPercentile) / sizeof(adPercentile[0]); uiIndex++)
+	{
+		printf(",%llu", (uiCount == 0) ? 0ULL : puiAll[(UINT64)(adPercentile[uiIndex] * (double)(uiCount - 1))]);
+	}
+
+	free(puiAll);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Read the monotonic clock
+//
+//	@param	: 	None
+//	@return	: 	The current time in nanoseconds
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static UINT64 BenchNow(void)
+{
+	struct timespec	sNow;
+
+	clock_gettime(CLOCK_MONOTONIC, &sNow);
+
+	return (UINT64)sNow.tv_sec * 1000000000ULL + (UINT64)sNow.tv_nsec;
+}
+
+static int BenchCompare(const void* pvLeft, const void* pvRight)
+{
+	UINT64	uiLeft	= *(const UINT64*)pvLeft;
+	UINT64	uiRight	= *(const UINT64*)pvRight;
+
+	return (uiLeft > uiRight) - (uiLeft < uiRight);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Parse a comma separated list of numbers
+//
+//	@param	: 	pcText is the list, e.g. "1,64,4096"
+//	@param	: 	psList receives the values
+//	@return	: 	TRUE if parsing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL BenchParseList(const char* pcText, SBenchList* psList)
+{
+	char*	pcEnd	= NULL;
+
+	psList->uiCount = 0;
+	while ((*pcText != '\0') && (psList->uiCount < BENCH_MAX_VALUES))
+	{
+		psList->auiValue[psList->uiCount] = strtoul(pcText, &pcEnd, 0);
+		if ((pcEnd == pcText) || (psList->auiValue[psList->uiCount] == 0))
+		{
+			return FALSE;
+		}
+
+		psList->uiCount++;
+		pcText = (*pcEnd == ',') ? (pcEnd + 1) : pcEnd;
+	}
+
+	return (*pcText == '\0') && (psList->uiCount > 0);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Parse a comma separated list of producer x consumer counts
+//
+//	@param	: 	pcText is the list, e.g. "1x1,2x2,1x4"
+//	@param	: 	psProducers receives the producer counts
+//	@param	: 	psConsumers receives the matching consumer counts
+//	@return	: 	TRUE if parsing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL BenchParseThreads(const char* pcText, SBenchList* psProducers, SBenchList* psConsumers)
+{
+	char*	pcEnd	= NULL;
+	UINT32	uiCount	= 0;
+
+	while ((*pcText != '\0') && (uiCount < BENCH_MAX_VALUES))
+	{
+		psProducers->auiValue[uiCount] = strtoul(pcText, &pcEnd, 0);
+		if ((pcEnd == pcText) || (*pcEnd != 'x'))
+		{
+			return FALSE;
+		}
+
+		pcText = pcEnd + 1;
+		psConsumers->auiValue[uiCount] = strtoul(pcText, &pcEnd, 0);
+		if ((pcEnd == pcText) ||
+			(psProducers->auiValue[uiCount] == 0) || (psProducers->auiValue[uiCount] > BENCH_MAX_THREADS) ||
+			(psConsumers->auiValue[uiCount] == 0) || (psConsumers->auiValue[uiCount] > BENCH_MAX_THREADS))
+		{
+			return FALSE;
+		}
+
+		uiCount++;
+		pcText = (*pcEnd == ',') ? (pcEnd + 1) : pcEnd;
+	}
+
+	psProducers->uiCount = uiCount;
+	psConsumers->uiCount = uiCount;
+
+	return (*pcText == '\0') && (uiCount > 0);
+}
+
+static void BenchUsage(const char* pcProgram)
+{
+	fprintf(stderr,
+			"Usage: %s [options]\n"
+			"  -m MODES      modes to run, any of mutex,ticket,pthread,adaptive,spsc,mpmc,broadcast (default all)\n"
+			"  -s SIZES      element sizes in byte (default 1,8,64,256,1024,4096)\n"
+			"  -b BATCHES    elements per push/pop call (default 1,16,64)\n"
+			"  -c CAPACITIES ring capacities in elements, powers of two (default 256,4096)\n"
+			"  -t THREADS    producer x consumer counts (default 1x1,2x2,1x4)\n"
+			"  -n ELEMENTS   elements moved per run (default 200000)\n"
+			"  -u            do not pin the threads to CPUs\n"
+			"Prints one CSV line per run. Latencies are per call, sampled 1 in %d calls\n",
+			pcProgram, BENCH_SAMPLE_INTERVAL);
+}
@@ -0,0 +1,181 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferFdRelay.c
+// 	Brief 		: 	Relay check of RingBufferFd.h. A byte pattern is written into a pipe, read into a
+//					ring buffer by BufferFillFromFd, written to a second pipe by BufferDrainToFd and
+//					read back and compared. The transfer sizes do not divide the buffer size, so the
+//					reserved and peeked regions wrap around the end of the data buffer
+//	Author 		: 	AnhNH57
+//  Note 		: 	POSIX only. Built by CMake with -DRING_BUFFER_BUILD_EXAMPLES=ON, exits with 0 if the
+//					relayed data matches
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <unistd.h>
+#include "RingBufferFd.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Number of bytes relayed
+#define RELAY_TOTAL_BYTES			1000000
+
+// Size of the ring buffer, not a divisor of the transfer sizes below
+#define RELAY_BUFFER_SIZE			1000
+
+// Maximum number of bytes of each write into the input pipe, fill and drain
+#define RELAY_WRITE_BYTES			777
+#define RELAY_FILL_BYTES			500
+#define RELAY_DRAIN_BYTES			333
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Byte number uiIndex of the relayed pattern
+#define RELAY_PATTERN(uiIndex)				((UCHAR)((uiIndex) * 7 + (uiIndex) / 251))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static BOOL		RelayOpenPipe(int aiFd[2]);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+static UCHAR	s_aucStorage[RELAY_BUFFER_SIZE] BUFFER_ALIGNED;
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Relay the pattern through the ring buffer and check it
+//
+//	@param	: 	None
+//	@return	: 	0 if the relayed data matches, 1 otherwise
+//	@note	:	Both pipes are non-blocking: BufferFillFromFd holds a reservation across its readv,
+//				so the input is also polled for readiness before filling
+// ---------------------------------------------------------------------------------------------------
+int main(void)
+{
+	SRingBuffer		sRingBuffer;
+	int				aiInput[2]		= { -1, -1 };
+	int				aiOutput[2]		= { -1, -1 };
+	struct pollfd	sPoll;
+	UCHAR			aucChunk[RELAY_WRITE_BYTES];
+	size_t			szWritten		= 0;
+	size_t			szRead			= 0;
+	size_t			szIndex			= 0;
+	ssize_t			iResult			= 0;
+	BOOL			bEndOfFile		= FALSE;
+
+	BufferInit(&sRingBuffer, s_aucStorage, RELAY_BUFFER_SIZE, 1, NULL, NULL, NULL);
+
+	if ((RelayOpenPipe(aiInput) == FALSE) || (RelayOpenPipe(aiOutput) == FALSE))
+	{
+		perror("pipe");
+		return 1;
+	}
+
+	while (szRead < RELAY_TOTAL_BYTES)
+	{
+		// Feed the input pipe, then close it so that the fill sees the end of file
+		if (szWritten < RELAY_TOTAL_BYTES)
+		{
+			for (szIndex = 0; (szIndex < RELAY_WRITE_BYTES) && (szWritten + szIndex < RELAY_TOTAL_BYTES); szIndex++)
+			{
+				aucChunk[szIndex] = RELAY_PATTERN(szWritten + szIndex);
+			}
+
+			iResult = write(aiInput[1], aucChunk, szIndex);
+			if (iResult > 0)
+			{
+				szWritten += (size_t)iResult;
+			}
+			else if (errno != EAGAIN)
+			{
+				perror("write");
+				return 1;
+			}
+
+			if (szWritten == RELAY_TOTAL_BYTES)
+			{
+				close(aiInput[1]);
+			}
+		}
+
+		// Fill the ring buffer once the input is readable
+		sPoll.fd		= aiInput[0];
+		sPoll.events	= POLLIN;
+		if ((bEndOfFile == FALSE) && (poll(&sPoll, 1, 0) > 0))
+		{
+			iResult = BufferFillFromFd(&sRingBuffer, aiInput[0], RELAY_FILL_BYTES);
+			if (iResult == 0)
+			{
+				bEndOfFile = TRUE;
+			}
+			else if ((iResult < 0) && (errno != ENOBUFS) && (errno != EAGAIN))
+			{
+				perror("BufferFillFromFd");
+				return 1;
+			}
+		}
+
+		// Drain the ring buffer into the output pipe
+		if ((BufferDrainToFd(&sRingBuffer, aiOutput[1], RELAY_DRAIN_BYTES) < 0) && (errno != EAGAIN))
+		{
+			perror("BufferDrainToFd");
+			return 1;
+		}
+
+		// Read back and compare
+		iResult = read(aiOutput[0], aucChunk, sizeof(aucChunk));
+		for (szIndex = 0; (iResult > 0) && (szIndex < (size_t)iResult); szIndex++)
+		{
+			if (aucChunk[szIndex] != RELAY_PATTERN(szRead + szIndex))
+			{
+				printf("FAILED: byte %zu differs\n", szRead + szIndex);
+				return 1;
+			}
+		}
+		if (iResult > 0)
+		{
+			szRead += (size_t)iResult;
+		}
+
+		if ((bEndOfFile == TRUE) && (BufferGetCount(&sRingBuffer) == 0) && (szRead < szWritten) && (iResult <= 0))
+		{
+			printf("FAILED: %zu bytes lost\n", szWritten - szRead);
+			return 1;
+		}
+	}
+
+	close(aiInput[0]);
+	close(aiOutput[0]);
+	close(aiOutput[1]);
+
+	printf("ok: %u bytes relayed\n", (unsigned)RELAY_TOTAL_BYTES);
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Create a pipe with both ends non-blocking
+//
+//	@param	: 	aiFd receives the read end and the write end
+//	@return	: 	TRUE if successful and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL RelayOpenPipe(int aiFd[2])
+{
+	if ((pipe(aiFd) != 0) ||
+		(fcntl(aiFd[0], F_SETFL, O_NONBLOCK) != 0) ||
+		(fcntl(aiFd[1], F_SETFL, O_NONBLOCK) != 0))
+	{
+		return FALSE;
+	}
+
+	return TRUE;
+}
@@ -10,20 +10,230 @@
 // 	Ver  	PIC  		Date       	Changes
 // 	----- 	-------- 	---------- 	------------------------------------------------------------------
 // 	1.00  	AnhNH57  	02-07-2013 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Add zero-copy reserve/commit for producers
+// 	1.02  	AnhNH57  	17-10-2026 	Add zero-copy peek/consume for consumers
+// 	1.03  	AnhNH57  	17-10-2026 	Support mirrored data buffers (see RingBufferMirror.h)
+// 	1.04  	AnhNH57  	17-10-2026 	Configurable index width, masked indexing for power-of-two sizes
+// 	1.05  	AnhNH57  	17-10-2026 	Add waiter notification for blocking operations (see RingBufferWait.h)
+// 	1.06  	AnhNH57  	17-10-2026 	Add eventfd readiness notification (see RingBufferEvent.h)
+// 	1.07  	AnhNH57  	17-10-2026 	Add read checkpoints protected from the producer
+// 	1.08  	AnhNH57  	17-10-2026 	Add optional statistics (see RingBufferStats.h)
+// 	1.09  	AnhNH57  	17-10-2026 	Add sampled queue-residency tracing (see RingBufferTrace.h)
+// 	1.10  	AnhNH57  	17-10-2026 	Add built-in locks (see RingBufferLock.h), no platform headers on Linux
+// 	1.11  	AnhNH57  	17-10-2026 	Size-dispatched data copies (see RingBufferCopy.h)
+// 	1.12  	AnhNH57  	17-10-2026 	Check the room and the count again under the lock
+// 	1.13  	AnhNH57  	17-10-2026 	Track the outstanding reservation with its own flag
+// 	1.14  	AnhNH57  	17-10-2026 	Add BufferRewind
+// 	1.15  	AnhNH57  	17-10-2026 	Add BufferGetAvailableCountUnlocked for polling
+// 	1.16  	AnhNH57  	17-10-2026 	Document that the alignment of the data storage is advisory
+// 	1.17  	AnhNH57  	17-10-2026 	Add BufferPeekConsume to parse and release elements under one lock
+// 	1.18  	AnhNH57  	17-10-2026 	Check that a checkpoint is live under the lock
 // 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 
 ////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <string.h>
 #include "RingBuffer.h"
-#include "Debug.h"
+#if (RING_BUFFER_PLATFORM_HEADERS == 1)
+	#include "Debug.h"
+#endif
+#if (RING_BUFFER_ENABLE_WAIT == 1)
+	#include "RingBufferWait.h"
+#endif
+#if (RING_BUFFER_ENABLE_EVENT == 1)
+	#include "RingBufferEvent.h"
+#endif
+#if (RING_BUFFER_ENABLE_STATS == 1)
+	#include "RingBufferStats.h"
+#endif
+#if (RING_BUFFER_TRACE_INTERVAL > 0)
+	#include "RingBufferTrace.h"
+#endif
+#if (RING_BUFFER_ENABLE_COPY_KERNELS == 1)
+	#include "RingBufferCopy.h"
+#endif
 
 ///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
 
 /////////////////////////////////////// Type Definitions /////////////////////////////////////////////
 
 ///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// When the buffer size is a power of two, the push and pop pointers run freely, they are wrapped by 
+// masking and the element count is derived from them. Otherwise the pointers are wrapped by 
+// compare-and-subtract and the element count is kept in uiElementCount
+#if (RING_BUFFER_POWER_OF_TWO == 1)
+	#define BUFFER_IS_MASKED(ps)			(TRUE)
+#else
+	#define BUFFER_IS_MASKED(ps)			((ps)->uiBufferMask != 0)
+#endif
+
+// Element count of the buffer
+#define BUFFER_COUNT(ps)					(BUFFER_IS_MASKED(ps) ? (BUFFER_INDEX)((ps)->uiBufferPushPtr - (ps)->uiBufferPopPtr) : (ps)->uiElementCount)
+
+// Index of the element in the data buffer which a push or pop pointer refers to
+#define BUFFER_SLOT(ps, uiPtr)				(BUFFER_IS_MASKED(ps) ? ((uiPtr) & (ps)->uiBufferMask) : (uiPtr))
+
+// Copy elements between the data buffer and the caller
+#if (RING_BUFFER_ENABLE_COPY_KERNELS == 1)
+	#define BUFFER_COPY(pvDestination, pvSource, szBytes)	BufferCopy((pvDestination), (pvSource), (szBytes))
+#else
+	#define BUFFER_COPY(pvDestination, pvSource, szBytes)	memcpy((pvDestination), (pvSource), (szBytes))
+#endif
+
+// Take the lock of the buffer for the push side or the pop side. With the statistics enabled the
+// time spent waiting for it is recorded into the histogram of that side
+#if (RING_BUFFER_ENABLE_STATS == 1)
+	#define BUFFER_LOCK_PUSH(ps)			do { if (BUFFER_HAS_LOCK(ps)) { BufferStatsLock((ps), &(ps)->sPushStats); } } while (0)
+	#define BUFFER_LOCK_POP(ps)				do { if (BUFFER_HAS_LOCK(ps)) { BufferStatsLock((ps), &(ps)->sPopStats); } } while (0)
+#else
+	#define BUFFER_LOCK_PUSH(ps)			BUFFER_LOCK(ps)
+	#define BUFFER_LOCK_POP(ps)				BUFFER_LOCK(ps)
+#endif
+
+// Count a successful call of one side, or a call rejected because the buffer was full (push) or 
+// empty (pop). The push side also tracks the high-water mark of the element count
+#if (RING_BUFFER_ENABLE_STATS == 1)
+	#define BUFFER_STATS_PUSHED(ps, uiLength)										\
+			do																		\
+			{																		\
+				BUFFER_STATS_ADD((ps)->sPushStats.uiCallCount, 1);					\
+				BUFFER_STATS_ADD((ps)->sPushStats.uiElementCount, (uiLength));		\
+				if (BUFFER_COUNT(ps) > (ps)->sPushStats.uiHighWaterMark)			\
+				{																	\
+					BUFFER_STATS_SET((ps)->sPushStats.uiHighWaterMark, BUFFER_COUNT(ps));	\
+				}																	\
+			} while (0)
+	#define BUFFER_STATS_POPPED(ps, uiLength)										\
+			do																		\
+			{																		\
+				BUFFER_STATS_ADD((ps)->sPopStats.uiCallCount, 1);					\
+				BUFFER_STATS_ADD((ps)->sPopStats.uiElementCount, (uiLength));		\
+			} while (0)
+	#define BUFFER_STATS_REJECT(ps, sSide)	__atomic_fetch_add(&(ps)->sSide.uiRejectCount, 1, __ATOMIC_RELAXED)
+#else
+	#define BUFFER_STATS_PUSHED(ps, uiLength)
+	#define BUFFER_STATS_POPPED(ps, uiLength)
+	#define BUFFER_STATS_REJECT(ps, sSide)
+#endif
+
+// Take a sample when a pushed element is due for it, and close the samples of the popped elements. 
+// Moving the pop pointer back makes the elements unread again, resynchronizing forgets the samples
+#if (RING_BUFFER_TRACE_INTERVAL > 0)
+	#define BUFFER_TRACE_PUSHED(ps, uiLength)										\
+			do																		\
+			{																		\
+				(ps)->sTrace.uiPushTotal += (uiLength);								\
+				if ((ps)->sTrace.uiPushTotal > (ps)->sTrace.uiNextSample)			\
+				{																	\
+					BufferTracePushed(ps);											\
+				}																	\
+			} while (0)
+	#define BUFFER_TRACE_POPPED(ps, uiLength)										\
+			do																		\
+			{																		\
+				(ps)->sTrace.uiPopTotal += (uiLength);								\
+				if (((ps)->sTrace.uiPendingHead != (ps)->sTrace.uiPendingTail) &&	\
+					((ps)->sTrace.auiPendingSequence[(ps)->sTrace.uiPendingHead] < (ps)->sTrace.uiPopTotal))	\
+				{																	\
+					BufferTracePopped(ps);											\
+				}																	\
+			} while (0)
+	#define BUFFER_TRACE_UNPOPPED(ps, uiLength)		((ps)->sTrace.uiPopTotal -= (uiLength))
+	#define BUFFER_TRACE_RESYNC(ps)													\
+			do																		\
+			{																		\
+				(ps)->sTrace.uiPendingHead	= (ps)->sTrace.uiPendingTail;			\
+				(ps)->sTrace.uiPopTotal		= (ps)->sTrace.uiPushTotal - BUFFER_COUNT(ps);	\
+			} while (0)
+#else
+	#define BUFFER_TRACE_PUSHED(ps, uiLength)
+	#define BUFFER_TRACE_POPPED(ps, uiLength)
+	#define BUFFER_TRACE_UNPOPPED(ps, uiLength)
+	#define BUFFER_TRACE_RESYNC(ps)
+#endif
+
+// Move the push pointer forward after uiLength elements are pushed in
+#define BUFFER_MOVE_PUSH_PTR(ps, uiLength)											\
+			do																		\
+			{																		\
+				(ps)->uiBufferPushPtr += (uiLength);								\
+				if (!BUFFER_IS_MASKED(ps))											\
+				{																	\
+					if ((ps)->uiBufferPushPtr >= (ps)->uiBufferSize)				\
+					{																\
+						(ps)->uiBufferPushPtr -= (ps)->uiBufferSize;				\
+					}																\
+					(ps)->uiElementCount += (uiLength);								\
+				}																	\
+				BUFFER_STATS_PUSHED(ps, uiLength);									\
+				BUFFER_TRACE_PUSHED(ps, uiLength);									\
+			} while (0)
+
+// Popped elements behind the oldest live checkpoint. They cannot be overwritten yet, so they are not
+// free for pushing. Popping adds to it while a checkpoint is live
+#if (RING_BUFFER_CHECKPOINTS > 0)
+	#define BUFFER_HELD(ps)					((ps)->uiHeldCount)
+	#define BUFFER_HOLD(ps, uiLength)												\
+			do																		\
+			{																		\
+				(ps)->uiPopTotal += (uiLength);										\
+				if ((ps)->uiCheckpointMask != 0)									\
+				{																	\
+					(ps)->uiHeldCount += (uiLength);								\
+				}																	\
+			} while (0)
+#else
+	#define BUFFER_HELD(ps)					0
+	#define BUFFER_HOLD(ps, uiLength)
+#endif
+
+// Number of elements which can be pushed in
+#define BUFFER_ROOM(ps)						((BUFFER_INDEX)((ps)->uiBufferSize - BUFFER_COUNT(ps) - BUFFER_HELD(ps)))
+
+// Move the pop pointer forward after uiLength elements are popped out
+#define BUFFER_MOVE_POP_PTR(ps, uiLength)											\
+			do																		\
+			{																		\
+				BUFFER_HOLD(ps, uiLength);											\
+				(ps)->uiBufferPopPtr += (uiLength);									\
+				if (!BUFFER_IS_MASKED(ps))											\
+				{																	\
+					if ((ps)->uiBufferPopPtr >= (ps)->uiBufferSize)					\
+					{																\
+						(ps)->uiBufferPopPtr -= (ps)->uiBufferSize;					\
+					}																\
+					(ps)->uiElementCount -= (uiLength);								\
+				}																	\
+				BUFFER_STATS_POPPED(ps, uiLength);									\
+				BUFFER_TRACE_POPPED(ps, uiLength);									\
+			} while (0)
+
+// Notify the pop side that elements were pushed in, and the push side that room was freed
+#if (RING_BUFFER_ENABLE_WAIT == 1)
+	#define BUFFER_WAIT_PUSHED(ps)			BUFFER_WAKE_POP_WAITERS(ps)
+	#define BUFFER_WAIT_POPPED(ps)			BUFFER_WAKE_PUSH_WAITERS(ps)
+#else
+	#define BUFFER_WAIT_PUSHED(ps)
+	#define BUFFER_WAIT_POPPED(ps)
+#endif
+
+#if (RING_BUFFER_ENABLE_EVENT == 1)
+	#define BUFFER_EVENT_PUSHED(ps)			BUFFER_RAISE_POP_EVENT(ps)
+	#define BUFFER_EVENT_POPPED(ps)			BUFFER_RAISE_PUSH_EVENT(ps)
+#else
+	#define BUFFER_EVENT_PUSHED(ps)
+	#define BUFFER_EVENT_POPPED(ps)
+#endif
+
+#define BUFFER_NOTIFY_PUSHED(ps)			do { BUFFER_WAIT_PUSHED(ps); BUFFER_EVENT_PUSHED(ps); } while (0)
+#define BUFFER_NOTIFY_POPPED(ps)			do { BUFFER_WAIT_POPPED(ps); BUFFER_EVENT_POPPED(ps); } while (0)
 
 ///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static BUFFER_INDEX	BufferGetSpans(SRingBuffer* psRingBuffer, SBufferSpan asSpan[BUFFER_SPAN_COUNT]);
+#if (RING_BUFFER_CHECKPOINTS > 0)
+static void		BufferCheckpointRewind(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength);
+static void		BufferCheckpointUpdateHeld(SRingBuffer* psRingBuffer);
+#endif
 
 ///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
 
@@ -33,16 +243,18 @@
 //	@brief	: 	Initialize a ring buffer
 //		  
 //	@param	: 	psRingBuffer is the structure of the ring buffer
-//	@param	: 	pvBuffer is the data storage area
+//	@param	: 	pvBuffer is the data storage area. Any alignment is accepted, a cache line aligned one
+//				(BUFFER_ALIGNED) only makes the copy kernels faster
 //	@param	:	uiBufferSize is the length of buffer or the number of elements in the buffer
 //	@param	:	uiElementSize is the size in byte of each elements in the buffer
 //	@param	:	ucMutexPrio is the priority of the mutex for synchronizing multi-access to the buffer
 //	@return	: 	Void
-//	@note	:
+//	@note	:	A power-of-two uiBufferSize selects the masked indexing fast path. It is mandatory when
+//				RING_BUFFER_POWER_OF_TWO is set
 // ---------------------------------------------------------------------------------------------------
 void BufferInit(SRingBuffer* psRingBuffer, 
 				void* pvBuffer, 
-				UINT16 uiBufferSize, 
+				BUFFER_INDEX uiBufferSize, 
 				UINT16 uiElementSize, 
 				CallbackFunction1I0O callbackLock, 
 				CallbackFunction1I0O callbackUnlock, 
@@ -53,6 +265,16 @@ void BufferInit(SRingBuffer* psRingBuffer,
 	psRingBuffer->uiBufferSize		= uiBufferSize;
 	psRingBuffer->uiElementSize		= uiElementSize;
 	
+	// Select the masked indexing if the size is a power of two
+	if ((uiBufferSize & (uiBufferSize - 1)) == 0)
+	{
+		psRingBuffer->uiBufferMask	= uiBufferSize - 1;
+	}
+	else
+	{
+		psRingBuffer->uiBufferMask	= 0;
+	}
+	
 	psRingBuffer->uiElementCount 	= 0;
 	psRingBuffer->uiBufferPopPtr	= 0;
 	psRingBuffer->uiBufferPushPtr	= 0;
@@ -63,12 +285,89 @@ void BufferInit(SRingBuffer* psRingBuffer,
 	
 	psRingBuffer->bBufferPopEnable	= TRUE;
 	psRingBuffer->bBufferPushEnable	= TRUE;
+	psRingBuffer->bBufferReserved	= FALSE;
+	psRingBuffer->uiReservedCount	= 0;
+	psRingBuffer->bBufferMirrored	= FALSE;
+
+#if (RING_BUFFER_CHECKPOINTS > 0)
+	psRingBuffer->uiPopTotal		= 0;
+	psRingBuffer->uiHeldCount		= 0;
+	psRingBuffer->uiCheckpointMask	= 0;
+#endif
+
+#if (RING_BUFFER_ENABLE_STATS == 1)
+	memset(&psRingBuffer->sPushStats, 0, sizeof(psRingBuffer->sPushStats));
+	memset(&psRingBuffer->sPopStats, 0, sizeof(psRingBuffer->sPopStats));
+#endif
+
+#if (RING_BUFFER_TRACE_INTERVAL > 0)
+	memset(&psRingBuffer->sTrace, 0, sizeof(psRingBuffer->sTrace));
+#endif
 	
 	psRingBuffer->callbackLock		= callbackLock;
 	psRingBuffer->callbackUnlock	= callbackUnlock;
 	psRingBuffer->pvCallbackParam	= pvCallbackParam;
+
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+	psRingBuffer->sLock.uiPolicy	= BUFFER_LOCK_CALLBACK;
+#endif
+
+#if (RING_BUFFER_ENABLE_WAIT == 1)
+	psRingBuffer->iPushFutex		= 0;
+	psRingBuffer->iPushWaiters		= 0;
+	psRingBuffer->iPopFutex			= 0;
+	psRingBuffer->iPopWaiters		= 0;
+#endif
+
+#if (RING_BUFFER_ENABLE_EVENT == 1)
+	// The events stay silent until BufferEventInit creates the descriptors
+	psRingBuffer->iPopEventFd		= -1;
+	psRingBuffer->iPushEventFd		= -1;
+	psRingBuffer->iPopEventArmed	= 0;
+	psRingBuffer->iPushEventArmed	= 0;
+#endif
 }	
 
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a ring buffer protected by a built-in lock
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvBuffer is the data storage area. Any alignment is accepted, a cache line aligned one
+//				(BUFFER_ALIGNED) only makes the copy kernels faster
+//	@param	:	uiBufferSize is the length of buffer or the number of elements in the buffer
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@param	:	uiLockPolicy is the lock, one of BUFFER_LOCK_xxx (see RingBufferLock.h)
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	The lock must be destroyed by BufferDeinit. A buffer initialized by BufferInitMirrored or
+//				BufferFrameInit gets a built-in lock by BufferLockCreate(&psRingBuffer->sLock, ...)
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferInitWithLock(SRingBuffer* psRingBuffer, 
+						void* pvBuffer, 
+						BUFFER_INDEX uiBufferSize, 
+						UINT16 uiElementSize, 
+						BUFFER_LOCK_POLICY uiLockPolicy)
+{
+	BufferInit(psRingBuffer, pvBuffer, uiBufferSize, uiElementSize, NULL, NULL, NULL);
+
+	return BufferLockCreate(&psRingBuffer->sLock, uiLockPolicy);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the built-in lock of a ring buffer
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer, not used by any other thread
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+void BufferDeinit(SRingBuffer* psRingBuffer)
+{
+	BufferLockDestroy(&psRingBuffer->sLock);
+}
+
+#endif
+
 // ---------------------------------------------------------------------------------------------------
 //	@brief	: 	Push a stream into ring buffer
 //		  
@@ -78,61 +377,63 @@ void BufferInit(SRingBuffer* psRingBuffer,
 //	@return	: 	TRUE if pushing successfully and vice versa
 //	@note	:
 // ---------------------------------------------------------------------------------------------------
-BOOL BufferPushStream(SRingBuffer* psRingBuffer, void* pvStream, UINT16 uiLength)
+BOOL BufferPushStream(SRingBuffer* psRingBuffer, void* pvStream, BUFFER_INDEX uiLength)
 {
-	UCHAR*	pvBuffer		= NULL;
-	UCHAR*	pvRestStream	= NULL;
+	BUFFER_INDEX	uiPushSlot		= 0;
+	UCHAR*			pvBuffer		= NULL;
+	UCHAR*			pvRestStream	= NULL;
 
-	if (((psRingBuffer->uiElementCount + uiLength) > psRingBuffer->uiBufferSize) || (psRingBuffer->bBufferPushEnable == FALSE))
+	if ((uiLength > BUFFER_ROOM(psRingBuffer)) || (psRingBuffer->bBufferPushEnable == FALSE))
 	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPushStats);
 		return FALSE;
 	}
 	
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
+	BUFFER_LOCK_PUSH(psRingBuffer);
+
+	// Check again, another producer sharing the buffer may have taken the room meanwhile. Nothing 
+	// can be pushed while a region is reserved, the push pointer belongs to the reservation
+	if ((uiLength > BUFFER_ROOM(psRingBuffer)) || (psRingBuffer->bBufferReserved == TRUE))
 	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
+		BUFFER_UNLOCK(psRingBuffer);
+		BUFFER_STATS_REJECT(psRingBuffer, sPushStats);
+		return FALSE;
 	}
 	
 	// Calculate the start address for pushing in
-	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + psRingBuffer->uiBufferPushPtr * psRingBuffer->uiElementSize;
+	uiPushSlot	= BUFFER_SLOT(psRingBuffer, psRingBuffer->uiBufferPushPtr);
+	pvBuffer	= (UCHAR*)psRingBuffer->pvBuffer + uiPushSlot * psRingBuffer->uiElementSize;
 
-	// If the pushing address is out of address range of the buffer then we need to push twice
-	if ((psRingBuffer->uiBufferPushPtr + uiLength) > psRingBuffer->uiBufferSize)
+	// If the pushing address is out of address range of the buffer then we need to push twice, 
+	// unless the buffer is mirrored so that the region is contiguous anyway
+	if ((uiLength > (psRingBuffer->uiBufferSize - uiPushSlot)) && (psRingBuffer->bBufferMirrored == FALSE))
 	{
 		// Push data stream from start address to the final address of the buffer
-		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * (psRingBuffer->uiBufferSize - psRingBuffer->uiBufferPushPtr));
+		BUFFER_COPY(pvBuffer, pvStream, psRingBuffer->uiElementSize * (psRingBuffer->uiBufferSize - uiPushSlot));
 
 		// Return the start address to the first address of the buffer for pushing the rest of stream
 		pvBuffer = (UCHAR*)psRingBuffer->pvBuffer;
 
 		// Point to address of the rest of stream
-		pvRestStream = (UCHAR*)pvStream + (psRingBuffer->uiBufferSize - psRingBuffer->uiBufferPushPtr) * psRingBuffer->uiElementSize;
+		pvRestStream = (UCHAR*)pvStream + (psRingBuffer->uiBufferSize - uiPushSlot) * psRingBuffer->uiElementSize;
 
 		// Push the rest of stream
-		memcpy(pvBuffer, pvRestStream, psRingBuffer->uiElementSize * (uiLength + psRingBuffer->uiBufferPushPtr - psRingBuffer->uiBufferSize));
+		BUFFER_COPY(pvBuffer, pvRestStream, psRingBuffer->uiElementSize * (uiLength + uiPushSlot - psRingBuffer->uiBufferSize));
 	}
 	else
 	{
 		// Push data stream
-		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiLength);
+		BUFFER_COPY(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiLength);
 	}
 
-	// Point the push pointer to the new position
-	psRingBuffer->uiBufferPushPtr += uiLength;
-	if (psRingBuffer->uiBufferPushPtr >= psRingBuffer->uiBufferSize)
-	{
-		psRingBuffer->uiBufferPushPtr -= psRingBuffer->uiBufferSize;
-	}
-
-	// Increase element count of the buffer
-	psRingBuffer->uiElementCount += uiLength;
+	// Point the push pointer to the new position and increase element count of the buffer
+	BUFFER_MOVE_PUSH_PTR(psRingBuffer, uiLength);
 	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
-	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_PUSHED(psRingBuffer);
 
 	return TRUE;	// Push successfully
 }	
@@ -146,72 +447,70 @@ BOOL BufferPushStream(SRingBuffer* psRingBuffer, void* pvStream, UINT16 uiLength
 //	@return	: 	The number of elements popped out actually
 //	@note	:
 // ---------------------------------------------------------------------------------------------------
-UINT16 BufferPopStream(SRingBuffer* psRingBuffer, void* pvStream, UINT16 uiLength)
+BUFFER_INDEX BufferPopStream(SRingBuffer* psRingBuffer, void* pvStream, BUFFER_INDEX uiLength)
 {
-	UINT16	uiPopCount		= 0;
-	UCHAR*	pvBuffer		= NULL;
-	UCHAR*	pvRestStream	= NULL;
+	BUFFER_INDEX	uiPopCount		= BUFFER_COUNT(psRingBuffer);
+	BUFFER_INDEX	uiPopSlot		= 0;
+	UCHAR*			pvBuffer		= NULL;
+	UCHAR*			pvRestStream	= NULL;
 
-	if ((psRingBuffer->uiElementCount == 0) || (psRingBuffer->bBufferPopEnable == FALSE))
+	if ((uiPopCount == 0) || (psRingBuffer->bBufferPopEnable == FALSE))
 	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
 		return 0;
 	}
 	
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
-	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_LOCK_POP(psRingBuffer);
 	
 	// Limit length of data stream will be popped
-	if (uiLength < psRingBuffer->uiElementCount)
+	uiPopCount = BUFFER_COUNT(psRingBuffer);
+	if (uiLength < uiPopCount)
 	{
 		uiPopCount = uiLength;
 	}
-	else
+
+	// Check again, another consumer sharing the buffer may have taken the elements meanwhile
+	if (uiPopCount == 0)
 	{
-		uiPopCount = psRingBuffer->uiElementCount;
+		BUFFER_UNLOCK(psRingBuffer);
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+		return 0;
 	}
 
 	// Calculate the start address for popping out
-	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + psRingBuffer->uiBufferPopPtr * psRingBuffer->uiElementSize;
+	uiPopSlot	= BUFFER_SLOT(psRingBuffer, psRingBuffer->uiBufferPopPtr);
+	pvBuffer	= (UCHAR*)psRingBuffer->pvBuffer + uiPopSlot * psRingBuffer->uiElementSize;
 
-	// If the popping address is out of address range of the buffer then we need to pop twice
-	if ((psRingBuffer->uiBufferPopPtr + uiPopCount) > psRingBuffer->uiBufferSize)
+	// If the popping address is out of address range of the buffer then we need to pop twice, 
+	// unless the buffer is mirrored so that the region is contiguous anyway
+	if ((uiPopCount > (psRingBuffer->uiBufferSize - uiPopSlot)) && (psRingBuffer->bBufferMirrored == FALSE))
 	{
 		// Pop data stream from start address to the final address of the buffer
-		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * (psRingBuffer->uiBufferSize - psRingBuffer->uiBufferPopPtr));
+		BUFFER_COPY(pvStream, pvBuffer, psRingBuffer->uiElementSize * (psRingBuffer->uiBufferSize - uiPopSlot));
 
 		// Return the start address to the first address of the buffer for popping the rest of stream
 		pvBuffer = (UCHAR*)psRingBuffer->pvBuffer;
 
 		// Point to address of the rest of stream
-		pvRestStream = (UCHAR*)pvStream + (psRingBuffer->uiBufferSize - psRingBuffer->uiBufferPopPtr) * psRingBuffer->uiElementSize;
+		pvRestStream = (UCHAR*)pvStream + (psRingBuffer->uiBufferSize - uiPopSlot) * psRingBuffer->uiElementSize;
 
 		// Pop the rest of stream
-		memcpy(pvRestStream, pvBuffer, psRingBuffer->uiElementSize * (uiPopCount + psRingBuffer->uiBufferPopPtr - psRingBuffer->uiBufferSize));
+		BUFFER_COPY(pvRestStream, pvBuffer, psRingBuffer->uiElementSize * (uiPopCount + uiPopSlot - psRingBuffer->uiBufferSize));
 	}
 	else
 	{
 		// Pop data stream
-		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiPopCount);
+		BUFFER_COPY(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiPopCount);
 	}
 
-	// Point the pop pointer to the new position
-	psRingBuffer->uiBufferPopPtr += uiPopCount;
-	if (psRingBuffer->uiBufferPopPtr >= psRingBuffer->uiBufferSize)
-	{
-		psRingBuffer->uiBufferPopPtr -= psRingBuffer->uiBufferSize;
-	}
-
-	// Decrease element count of the buffer
-	psRingBuffer->uiElementCount -=uiPopCount;
+	// Point the pop pointer to the new position and decrease element count of the buffer
+	BUFFER_MOVE_POP_PTR(psRingBuffer, uiPopCount);
 	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
-	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
 
 	return uiPopCount;	// Return the number of elements popped out actually
 }
@@ -228,38 +527,37 @@ BOOL BufferPush(SRingBuffer* psRingBuffer, void* pvData)
 {
 	UCHAR*	pvBuffer	= NULL;
 
-	if ((psRingBuffer->uiElementCount >= psRingBuffer->uiBufferSize) || (psRingBuffer->bBufferPushEnable == FALSE))
+	if ((BUFFER_ROOM(psRingBuffer) == 0) || (psRingBuffer->bBufferPushEnable == FALSE))
 	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPushStats);
 		return FALSE;
 	}
 	
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
+	BUFFER_LOCK_PUSH(psRingBuffer);
+
+	// Check again, another producer sharing the buffer may have taken the room meanwhile. Nothing 
+	// can be pushed while a region is reserved, the push pointer belongs to the reservation
+	if ((BUFFER_ROOM(psRingBuffer) == 0) || (psRingBuffer->bBufferReserved == TRUE))
 	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
+		BUFFER_UNLOCK(psRingBuffer);
+		BUFFER_STATS_REJECT(psRingBuffer, sPushStats);
+		return FALSE;
 	}
 
 	// Calculate the start address for pushing in
-	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + psRingBuffer->uiBufferPushPtr * psRingBuffer->uiElementSize;
+	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + BUFFER_SLOT(psRingBuffer, psRingBuffer->uiBufferPushPtr) * psRingBuffer->uiElementSize;
 
 	// Push data element
-	memcpy(pvBuffer, pvData, psRingBuffer->uiElementSize);
-
-	// Point the push pointer to the new position
-	psRingBuffer->uiBufferPushPtr++;
-	if (psRingBuffer->uiBufferPushPtr >= psRingBuffer->uiBufferSize)
-	{
-		psRingBuffer->uiBufferPushPtr = 0;
-	}
+	BUFFER_COPY(pvBuffer, pvData, psRingBuffer->uiElementSize);
 
-	// Increase element count of the buffer
-	psRingBuffer->uiElementCount++;
+	// Point the push pointer to the new position and increase element count of the buffer
+	BUFFER_MOVE_PUSH_PTR(psRingBuffer, 1);
 	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
-	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_PUSHED(psRingBuffer);
 
 	return TRUE;
 }
@@ -272,44 +570,283 @@ BOOL BufferPush(SRingBuffer* psRingBuffer, void* pvData)
 //	@return	: 	The number of elements popped out actually
 //	@note	:
 // ---------------------------------------------------------------------------------------------------
-UINT16 BufferPop(SRingBuffer* psRingBuffer, void* pvData)
+BUFFER_INDEX BufferPop(SRingBuffer* psRingBuffer, void* pvData)
 {
 	UCHAR*	pvBuffer	= NULL;
 
-	if ((psRingBuffer->uiElementCount == 0) || (psRingBuffer->bBufferPopEnable == FALSE))
+	if ((BUFFER_COUNT(psRingBuffer) == 0) || (psRingBuffer->bBufferPopEnable == FALSE))
 	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
 		return 0;
 	}
 	
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
+	BUFFER_LOCK_POP(psRingBuffer);
+
+	// Check again, another consumer sharing the buffer may have taken the element meanwhile
+	if (BUFFER_COUNT(psRingBuffer) == 0)
 	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
+		BUFFER_UNLOCK(psRingBuffer);
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+		return 0;
 	}
 
 	// Calculate the start address for popping out
-	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + psRingBuffer->uiBufferPopPtr * psRingBuffer->uiElementSize;
+	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + BUFFER_SLOT(psRingBuffer, psRingBuffer->uiBufferPopPtr) * psRingBuffer->uiElementSize;
 
 	// Pop data element
-	memcpy(pvData, pvBuffer, psRingBuffer->uiElementSize);
+	BUFFER_COPY(pvData, pvBuffer, psRingBuffer->uiElementSize);
+
+	// Point the pop pointer to the new position and decrease element count of the buffer
+	BUFFER_MOVE_POP_PTR(psRingBuffer, 1);
+	
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Reserve a writable region inside the data buffer so that the producer can write the 
+//				elements in place instead of copying them from its own buffer
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	uiLength is the number of elements to be reserved
+//	@param	: 	asSpan receives the reserved region. Because of wraparound the region may be split
+//				into two spans, the second one has zero length if it is not split
+//	@return	: 	TRUE if reserving successfully and vice versa
+//	@note	:	Pushing and reserving are refused until the reservation is finished by BufferCommit, 
+//				so only one reservation can be outstanding at a time
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferReserve(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength, SBufferSpan asSpan[BUFFER_SPAN_COUNT])
+{
+	BUFFER_INDEX	uiPushSlot		= 0;
+	BUFFER_INDEX	uiFirstLength	= 0;
+	BOOL			bResult			= FALSE;
 
-	// Point the pop pointer to the new position
-	psRingBuffer->uiBufferPopPtr++;
-	if (psRingBuffer->uiBufferPopPtr >= psRingBuffer->uiBufferSize)
+	// Lock accessing to the buffer
+	BUFFER_LOCK_PUSH(psRingBuffer);
+
+	if ((uiLength <= BUFFER_ROOM(psRingBuffer)) && 
+		(psRingBuffer->bBufferPushEnable == TRUE) && (psRingBuffer->bBufferReserved == FALSE))
 	{
-		psRingBuffer->uiBufferPopPtr = 0;
+		// Mark the region as reserved to prohibit other producers from writing into it
+		psRingBuffer->bBufferReserved	= TRUE;
+		psRingBuffer->uiReservedCount	= uiLength;
+
+		// The first span runs from the push pointer to the end of the buffer at most, or covers the 
+		// whole region if the buffer is mirrored
+		uiPushSlot		= BUFFER_SLOT(psRingBuffer, psRingBuffer->uiBufferPushPtr);
+		uiFirstLength	= psRingBuffer->uiBufferSize - uiPushSlot;
+		if ((uiLength < uiFirstLength) || (psRingBuffer->bBufferMirrored == TRUE))
+		{
+			uiFirstLength = uiLength;
+		}
+
+		asSpan[0].pvData	= (UCHAR*)psRingBuffer->pvBuffer + uiPushSlot * psRingBuffer->uiElementSize;
+		asSpan[0].uiLength	= uiFirstLength;
+		asSpan[1].pvData	= psRingBuffer->pvBuffer;
+		asSpan[1].uiLength	= uiLength - uiFirstLength;
+
+		bResult = TRUE;
+	}
+	else
+	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPushStats);
 	}
 
-	// Decrease element count of the buffer
-	psRingBuffer->uiElementCount--;
-	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
+	BUFFER_UNLOCK(psRingBuffer);
+
+	return bResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Commit the elements written into the region reserved by BufferReserve
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	uiLength is the number of elements actually written, from the start of the first span.
+//				Zero cancels the reservation
+//	@return	: 	TRUE if committing successfully and vice versa
+//	@note	:	The rest of the reserved region is given back and pushing is allowed again
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferCommit(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength)
+{
+	// Lock accessing to the buffer
+	BUFFER_LOCK_PUSH(psRingBuffer);
+
+	// Cannot commit more than reserved or without a reservation
+	if ((psRingBuffer->bBufferReserved == FALSE) || (uiLength > psRingBuffer->uiReservedCount))
 	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
+		BUFFER_UNLOCK(psRingBuffer);
+		return FALSE;
 	}
 
-	return 1;
+	// Point the push pointer to the new position and increase element count of the buffer
+	BUFFER_MOVE_PUSH_PTR(psRingBuffer, uiLength);
+
+	// Finish the reservation
+	psRingBuffer->bBufferReserved	= FALSE;
+	psRingBuffer->uiReservedCount	= 0;
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	// Wake the consumers for the committed elements and the producers which were refused meanwhile
+	BUFFER_NOTIFY_PUSHED(psRingBuffer);
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get read-only views of the elements in the buffer so that the consumer can parse them 
+//				in place instead of copying them out
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	asSpan receives the occupied region. Because of wraparound the region may be split
+//				into two spans, the second one has zero length if it is not split
+//	@return	: 	The number of elements in the spans
+//	@note	:	The elements stay in the buffer until they are released by BufferConsume
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPeek(SRingBuffer* psRingBuffer, SBufferSpan asSpan[BUFFER_SPAN_COUNT])
+{
+	BUFFER_INDEX	uiPeekCount		= 0;
+
+	asSpan[0].pvData	= psRingBuffer->pvBuffer;
+	asSpan[0].uiLength	= 0;
+	asSpan[1].pvData	= psRingBuffer->pvBuffer;
+	asSpan[1].uiLength	= 0;
+
+	if ((BUFFER_COUNT(psRingBuffer) == 0) || (psRingBuffer->bBufferPopEnable == FALSE))
+	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+		return 0;
+	}
+
+	// Lock accessing to the buffer
+	BUFFER_LOCK_POP(psRingBuffer);
+
+	uiPeekCount = BufferGetSpans(psRingBuffer, asSpan);
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	// Check again, another consumer sharing the buffer may have taken the elements meanwhile
+	if (uiPeekCount == 0)
+	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+	}
+
+	return uiPeekCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release elements from the buffer without copying them out
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	uiLength is the number of elements to be released
+//	@return	: 	The number of elements released actually
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferConsume(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength)
+{
+	BUFFER_INDEX	uiConsumeCount	= BUFFER_COUNT(psRingBuffer);
+
+	if ((uiConsumeCount == 0) || (psRingBuffer->bBufferPopEnable == FALSE))
+	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+		return 0;
+	}
+
+	// Lock accessing to the buffer
+	BUFFER_LOCK_POP(psRingBuffer);
+
+	// Limit the number of elements will be released
+	uiConsumeCount = BUFFER_COUNT(psRingBuffer);
+	if (uiLength < uiConsumeCount)
+	{
+		uiConsumeCount = uiLength;
+	}
+
+	// Check again, another consumer sharing the buffer may have released the elements meanwhile
+	if (uiConsumeCount == 0)
+	{
+		BUFFER_UNLOCK(psRingBuffer);
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+		return 0;
+	}
+
+	// Point the pop pointer to the new position and decrease element count of the buffer
+	BUFFER_MOVE_POP_PTR(psRingBuffer, uiConsumeCount);
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
+
+	return uiConsumeCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Parse the elements in the buffer in place and release the parsed ones, all under one
+//				lock, so that consumers sharing the buffer never parse the same elements
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	pfnParse is called with the occupied region, as given by BufferPeek, and returns the
+//				number of elements to be released
+//	@param	:	pvParam is the parameter of pfnParse
+//	@return	: 	The number of elements released actually
+//	@note	:	pfnParse runs with the buffer locked, it must not call the functions of this buffer
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPeekConsume(SRingBuffer* psRingBuffer, BufferParseFunction pfnParse, void* pvParam)
+{
+	SBufferSpan		asSpan[BUFFER_SPAN_COUNT];
+	BUFFER_INDEX	uiPeekCount		= 0;
+	BUFFER_INDEX	uiConsumeCount	= 0;
+
+	if ((BUFFER_COUNT(psRingBuffer) == 0) || (psRingBuffer->bBufferPopEnable == FALSE))
+	{
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+		return 0;
+	}
+
+	// Lock accessing to the buffer
+	BUFFER_LOCK_POP(psRingBuffer);
+
+	// Check again, another consumer sharing the buffer may have taken the elements meanwhile
+	uiPeekCount = BufferGetSpans(psRingBuffer, asSpan);
+	if (uiPeekCount == 0)
+	{
+		BUFFER_UNLOCK(psRingBuffer);
+		BUFFER_STATS_REJECT(psRingBuffer, sPopStats);
+		return 0;
+	}
+
+	// Limit the number of elements will be released
+	uiConsumeCount = pfnParse(asSpan, pvParam);
+	if (uiConsumeCount > uiPeekCount)
+	{
+		uiConsumeCount = uiPeekCount;
+	}
+
+	if (uiConsumeCount == 0)
+	{
+		BUFFER_UNLOCK(psRingBuffer);
+		return 0;
+	}
+
+	// Point the pop pointer to the new position and decrease element count of the buffer
+	BUFFER_MOVE_POP_PTR(psRingBuffer, uiConsumeCount);
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
+
+	return uiConsumeCount;
 }
 
 // ---------------------------------------------------------------------------------------------------
@@ -321,44 +858,56 @@ UINT16 BufferPop(SRingBuffer* psRingBuffer, void* pvData)
 //	@return	: 	TRUE if pushing successfully and vice versa
 //	@note	:
 // ---------------------------------------------------------------------------------------------------
-BOOL BufferPushBack(SRingBuffer* psRingBuffer, UINT16 uiPushBackNumber)
+BOOL BufferPushBack(SRingBuffer* psRingBuffer, BUFFER_INDEX uiPushBackNumber)
 {
-	// Cannot push back if the push back number is greater than the available element count
-	if (uiPushBackNumber > (psRingBuffer->uiBufferSize - psRingBuffer->uiElementCount))
-	{
-		return FALSE;
-	}
-
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
+	BUFFER_LOCK(psRingBuffer);
+
+	// Cannot push back if the push back number is greater than the available element count, the 
+	// reserved region is not available
+	if (uiPushBackNumber > (psRingBuffer->uiBufferSize - BUFFER_COUNT(psRingBuffer) - psRingBuffer->uiReservedCount))
 	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
+		BUFFER_UNLOCK(psRingBuffer);
+		return FALSE;
 	}
 
 	// Disable pushing to prohibiting changing of push pointer
 	psRingBuffer->bBufferPushEnable = FALSE;
 
-	// Push back element count
-	psRingBuffer->uiElementCount += uiPushBackNumber;
-
-	// Push back pop pointer
-	if (psRingBuffer->uiBufferPopPtr >= uiPushBackNumber)
+	if (BUFFER_IS_MASKED(psRingBuffer))
 	{
+		// Push back pop pointer, the element count follows it
 		psRingBuffer->uiBufferPopPtr -= uiPushBackNumber;
 	}
 	else
 	{
-		psRingBuffer->uiBufferPopPtr = psRingBuffer->uiBufferPopPtr + psRingBuffer->uiBufferSize - uiPushBackNumber;
+		// Push back element count
+		psRingBuffer->uiElementCount += uiPushBackNumber;
+
+		// Push back pop pointer
+		if (psRingBuffer->uiBufferPopPtr >= uiPushBackNumber)
+		{
+			psRingBuffer->uiBufferPopPtr -= uiPushBackNumber;
+		}
+		else
+		{
+			psRingBuffer->uiBufferPopPtr = psRingBuffer->uiBufferPopPtr + psRingBuffer->uiBufferSize - uiPushBackNumber;
+		}
 	}
 
+#if (RING_BUFFER_CHECKPOINTS > 0)
+	// The pushed back elements are unread again
+	BufferCheckpointRewind(psRingBuffer, uiPushBackNumber);
+#endif
+	BUFFER_TRACE_UNPOPPED(psRingBuffer, uiPushBackNumber);
+
 	// Enable pushing
 	psRingBuffer->bBufferPushEnable = TRUE;
 
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
-	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_PUSHED(psRingBuffer);
 
 	return TRUE;
 }
@@ -372,7 +921,7 @@ BOOL BufferPushBack(SRingBuffer* psRingBuffer, UINT16 uiPushBackNumber)
 // ---------------------------------------------------------------------------------------------------
 BOOL BufferIsPushEnable(SRingBuffer* psRingBuffer)
 {
-	if (psRingBuffer->uiElementCount >= psRingBuffer->uiBufferSize)
+	if (BUFFER_ROOM(psRingBuffer) == 0)
 	{
 		return FALSE;
 	}
@@ -389,7 +938,7 @@ BOOL BufferIsPushEnable(SRingBuffer* psRingBuffer)
 // ---------------------------------------------------------------------------------------------------
 BOOL BufferIsPopEnable(SRingBuffer* psRingBuffer)
 {
-	if (psRingBuffer->uiElementCount == 0)
+	if (BUFFER_COUNT(psRingBuffer) == 0)
 	{
 		return FALSE;
 	}
@@ -407,6 +956,8 @@ BOOL BufferIsPopEnable(SRingBuffer* psRingBuffer)
 void BufferEnablePop(SRingBuffer* psRingBuffer)
 {
 	psRingBuffer->bBufferPopEnable = TRUE;
+
+	BUFFER_NOTIFY_PUSHED(psRingBuffer);
 }
 
 // ---------------------------------------------------------------------------------------------------
@@ -431,6 +982,8 @@ void BufferDisablePop(SRingBuffer* psRingBuffer)
 void BufferEnablePush(SRingBuffer* psRingBuffer)
 {
 	psRingBuffer->bBufferPushEnable = TRUE;
+
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
 }
 
 // ---------------------------------------------------------------------------------------------------
@@ -452,9 +1005,9 @@ void BufferDisablePush(SRingBuffer* psRingBuffer)
 //	@return	: 	Element count of the buffer
 //	@note	:
 // ---------------------------------------------------------------------------------------------------
-UINT16 BufferGetCount(SRingBuffer* psRingBuffer)
+BUFFER_INDEX BufferGetCount(SRingBuffer* psRingBuffer)
 {
-	return psRingBuffer->uiElementCount;
+	return BUFFER_COUNT(psRingBuffer);
 }
 
 // ---------------------------------------------------------------------------------------------------
@@ -464,27 +1017,34 @@ UINT16 BufferGetCount(SRingBuffer* psRingBuffer)
 //	@return	: 	Available element count of the buffer
 //	@note	:
 // ---------------------------------------------------------------------------------------------------
-UINT16 BufferGetAvailableCount(SRingBuffer* psRingBuffer)
+BUFFER_INDEX BufferGetAvailableCount(SRingBuffer* psRingBuffer)
 {
-	UINT16	uiBufferAvailableCount	= 0;
+	BUFFER_INDEX	uiBufferAvailableCount	= 0;
 
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
-	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_LOCK(psRingBuffer);
 	
-	uiBufferAvailableCount = psRingBuffer->uiBufferSize - psRingBuffer->uiElementCount;
+	uiBufferAvailableCount = BUFFER_ROOM(psRingBuffer);
 	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
-	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_UNLOCK(psRingBuffer);
 	
 	return (uiBufferAvailableCount);
 }
 
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the available element count of the buffer without locking it
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Available element count of the buffer
+//	@note	:	A snapshot for polling, e.g. by a waiting caller. It may be out of date as soon as it
+//				is read, so the push itself must still check the room under the lock
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferGetAvailableCountUnlocked(SRingBuffer* psRingBuffer)
+{
+	return BUFFER_ROOM(psRingBuffer);
+}
+
 // ---------------------------------------------------------------------------------------------------
 //	@brief	: 	Save the current state of the ring buffer
 //		  
@@ -495,20 +1055,14 @@ UINT16 BufferGetAvailableCount(SRingBuffer* psRingBuffer)
 void BufferSaveState(SRingBuffer* psRingBuffer)
 {
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
-	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_LOCK(psRingBuffer);
 	
 	psRingBuffer->uiBKElementCount	= psRingBuffer->uiElementCount;
 	psRingBuffer->uiBKBufferPopPtr	= psRingBuffer->uiBufferPopPtr;
 	psRingBuffer->uiBKBufferPushPtr	= psRingBuffer->uiBufferPushPtr;
 	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
-	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_UNLOCK(psRingBuffer);
 }
 
 // ---------------------------------------------------------------------------------------------------
@@ -521,20 +1075,24 @@ void BufferSaveState(SRingBuffer* psRingBuffer)
 void BufferRestoreState(SRingBuffer* psRingBuffer)
 {
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
-	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_LOCK(psRingBuffer);
 	
 	psRingBuffer->uiElementCount	= psRingBuffer->uiBKElementCount;
 	psRingBuffer->uiBufferPopPtr	= psRingBuffer->uiBKBufferPopPtr;
 	psRingBuffer->uiBufferPushPtr	= psRingBuffer->uiBKBufferPushPtr;
+
+#if (RING_BUFFER_CHECKPOINTS > 0)
+	// The checkpoints may not match the restored pointers any more
+	psRingBuffer->uiHeldCount		= 0;
+	psRingBuffer->uiCheckpointMask	= 0;
+#endif
+	BUFFER_TRACE_RESYNC(psRingBuffer);
 	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
-	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_PUSHED(psRingBuffer);
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
 }
 
 // ---------------------------------------------------------------------------------------------------
@@ -542,25 +1100,276 @@ void BufferRestoreState(SRingBuffer* psRingBuffer)
 //		  
 //	@param	: 	psRingBuffer is the structure of the ring buffer
 //	@return	: 	Void
-//	@note	:
+//	@note	:	An outstanding reservation is dropped, its BufferCommit fails
 // ---------------------------------------------------------------------------------------------------
 void BufferFlush(SRingBuffer* psRingBuffer)
 {
 	// Lock accessing to the buffer
-	if (psRingBuffer->callbackLock)
-	{
-		psRingBuffer->callbackLock(psRingBuffer->pvCallbackParam);
-	}
+	BUFFER_LOCK(psRingBuffer);
 	
 	psRingBuffer->uiElementCount 	= 0;
 	psRingBuffer->uiBufferPopPtr	= 0;	
 	psRingBuffer->uiBufferPushPtr	= 0;    
 	psRingBuffer->bBufferPopEnable	= TRUE;
 	psRingBuffer->bBufferPushEnable = TRUE;
+	psRingBuffer->bBufferReserved	= FALSE;
+	psRingBuffer->uiReservedCount	= 0;
+
+#if (RING_BUFFER_CHECKPOINTS > 0)
+	psRingBuffer->uiPopTotal		= 0;
+	psRingBuffer->uiHeldCount		= 0;
+	psRingBuffer->uiCheckpointMask	= 0;
+#endif
+	BUFFER_TRACE_RESYNC(psRingBuffer);
 	
 	// Unlock accessing to the buffer
-	if (psRingBuffer->callbackUnlock)
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Point the push and pop pointers back to the start of the data buffer if it is empty, 
+//				so that the next push or reservation is not split by the end of it
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	TRUE if rewinding successfully, FALSE if the buffer holds elements, a region is 
+//				reserved or a checkpoint is live
+//	@note	:	The pop side moves the pointers too, so a buffer shared between threads must be locked
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferRewind(SRingBuffer* psRingBuffer)
+{
+	BOOL	bResult	= FALSE;
+
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	if ((BUFFER_COUNT(psRingBuffer) == 0) && (psRingBuffer->bBufferReserved == FALSE)
+#if (RING_BUFFER_CHECKPOINTS > 0)
+		&& (psRingBuffer->uiCheckpointMask == 0)
+#endif
+		)
+	{
+		psRingBuffer->uiBufferPopPtr	= 0;
+		psRingBuffer->uiBufferPushPtr	= 0;
+
+		bResult = TRUE;
+	}
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	return bResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the occupied region of the buffer
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	asSpan receives the occupied region, split into two spans because of wraparound
+//	@return	: 	The number of elements in the spans
+//	@note	:	Called with the buffer locked
+// ---------------------------------------------------------------------------------------------------
+static BUFFER_INDEX BufferGetSpans(SRingBuffer* psRingBuffer, SBufferSpan asSpan[BUFFER_SPAN_COUNT])
+{
+	BUFFER_INDEX	uiPeekCount		= BUFFER_COUNT(psRingBuffer);
+	BUFFER_INDEX	uiPopSlot		= 0;
+	BUFFER_INDEX	uiFirstLength	= 0;
+
+	if (uiPeekCount == 0)
+	{
+		return 0;
+	}
+
+	// The first span runs from the pop pointer to the end of the buffer at most, or covers the 
+	// whole region if the buffer is mirrored
+	uiPopSlot		= BUFFER_SLOT(psRingBuffer, psRingBuffer->uiBufferPopPtr);
+	uiFirstLength	= psRingBuffer->uiBufferSize - uiPopSlot;
+	if ((uiPeekCount < uiFirstLength) || (psRingBuffer->bBufferMirrored == TRUE))
+	{
+		uiFirstLength = uiPeekCount;
+	}
+
+	asSpan[0].pvData	= (UCHAR*)psRingBuffer->pvBuffer + uiPopSlot * psRingBuffer->uiElementSize;
+	asSpan[0].uiLength	= uiFirstLength;
+	asSpan[1].pvData	= psRingBuffer->pvBuffer;
+	asSpan[1].uiLength	= uiPeekCount - uiFirstLength;
+
+	return uiPeekCount;
+}
+
+#if (RING_BUFFER_CHECKPOINTS > 0)
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Create a checkpoint at the current read position. Elements popped from now on stay in
+//				the buffer, the producer cannot overwrite them until the checkpoint is released
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	phCheckpoint receives the handle of the checkpoint
+//	@return	: 	TRUE if creating successfully, FALSE if RING_BUFFER_CHECKPOINTS checkpoints are live
+//	@note	:	Checkpoints can be nested, each one is rolled back and released on its own
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferCheckpointCreate(SRingBuffer* psRingBuffer, BUFFER_CHECKPOINT* phCheckpoint)
+{
+	BUFFER_CHECKPOINT	hCheckpoint	= 0;
+	BOOL				bResult		= FALSE;
+
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	for (hCheckpoint = 0; hCheckpoint < RING_BUFFER_CHECKPOINTS; hCheckpoint++)
+	{
+		if ((psRingBuffer->uiCheckpointMask & (1UL << hCheckpoint)) == 0)
+		{
+			psRingBuffer->auiCheckpointPopPtr[hCheckpoint]		= psRingBuffer->uiBufferPopPtr;
+			psRingBuffer->auiCheckpointPopTotal[hCheckpoint]	= psRingBuffer->uiPopTotal;
+			psRingBuffer->uiCheckpointMask						|= (1UL << hCheckpoint);
+
+			*phCheckpoint	= hCheckpoint;
+			bResult			= TRUE;
+			break;
+		}
+	}
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	return bResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Move the read position back to a checkpoint. The elements popped since then can be
+//				popped again. Nothing is copied
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	hCheckpoint is the handle given by BufferCheckpointCreate
+//	@return	: 	TRUE if rolling back successfully, FALSE if the checkpoint is not live
+//	@note	:	The checkpoint stays live. The checkpoints created ahead of it are released
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferCheckpointRollback(SRingBuffer* psRingBuffer, BUFFER_CHECKPOINT hCheckpoint)
+{
+	BUFFER_INDEX	uiLength	= 0;
+
+	if (hCheckpoint >= RING_BUFFER_CHECKPOINTS)
+	{
+		return FALSE;
+	}
+
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	// The checkpoint may be released meanwhile, by another caller or by a rollback to an older one
+	if ((psRingBuffer->uiCheckpointMask & (1UL << hCheckpoint)) == 0)
+	{
+		BUFFER_UNLOCK(psRingBuffer);
+		return FALSE;
+	}
+
+	// Point the pop pointer back to the checkpoint and increase element count of the buffer
+	uiLength						= psRingBuffer->uiPopTotal - psRingBuffer->auiCheckpointPopTotal[hCheckpoint];
+	psRingBuffer->uiBufferPopPtr	= psRingBuffer->auiCheckpointPopPtr[hCheckpoint];
+	if (!BUFFER_IS_MASKED(psRingBuffer))
+	{
+		psRingBuffer->uiElementCount += uiLength;
+	}
+
+	BufferCheckpointRewind(psRingBuffer, uiLength);
+	BUFFER_TRACE_UNPOPPED(psRingBuffer, uiLength);
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_PUSHED(psRingBuffer);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release a checkpoint. The elements only it was holding become free for pushing
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	hCheckpoint is the handle given by BufferCheckpointCreate
+//	@return	: 	TRUE if releasing successfully, FALSE if the checkpoint is not live
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferCheckpointRelease(SRingBuffer* psRingBuffer, BUFFER_CHECKPOINT hCheckpoint)
+{
+	if (hCheckpoint >= RING_BUFFER_CHECKPOINTS)
+	{
+		return FALSE;
+	}
+
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	// The checkpoint may be released meanwhile, by another caller or by a rollback to an older one
+	if ((psRingBuffer->uiCheckpointMask & (1UL << hCheckpoint)) == 0)
+	{
+		BUFFER_UNLOCK(psRingBuffer);
+		return FALSE;
+	}
+
+	psRingBuffer->uiCheckpointMask &= ~(1UL << hCheckpoint);
+	BufferCheckpointUpdateHeld(psRingBuffer);
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+
+	BUFFER_NOTIFY_POPPED(psRingBuffer);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Account for uiLength popped elements becoming unread again
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiLength is the number of elements the pop pointer moved back by
+//	@return	: 	Void
+//	@note	:	Called with the buffer locked. The checkpoints inside the rewound range point ahead of
+//				the read position now, they are released
+// ---------------------------------------------------------------------------------------------------
+static void BufferCheckpointRewind(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength)
+{
+	BUFFER_CHECKPOINT	hCheckpoint	= 0;
+
+	for (hCheckpoint = 0; hCheckpoint < RING_BUFFER_CHECKPOINTS; hCheckpoint++)
+	{
+		if (((psRingBuffer->uiCheckpointMask & (1UL << hCheckpoint)) != 0) &&
+			((BUFFER_INDEX)(psRingBuffer->uiPopTotal - psRingBuffer->auiCheckpointPopTotal[hCheckpoint]) < uiLength))
+		{
+			psRingBuffer->uiCheckpointMask &= ~(1UL << hCheckpoint);
+		}
+	}
+
+	psRingBuffer->uiPopTotal -= uiLength;
+	BufferCheckpointUpdateHeld(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Recalculate the number of popped elements held by the oldest live checkpoint
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	Called with the buffer locked
+// ---------------------------------------------------------------------------------------------------
+static void BufferCheckpointUpdateHeld(SRingBuffer* psRingBuffer)
+{
+	BUFFER_CHECKPOINT	hCheckpoint	= 0;
+	BUFFER_INDEX		uiHeldCount	= 0;
+
+	psRingBuffer->uiHeldCount = 0;
+	for (hCheckpoint = 0; hCheckpoint < RING_BUFFER_CHECKPOINTS; hCheckpoint++)
 	{
-		psRingBuffer->callbackUnlock(psRingBuffer->pvCallbackParam);
+		if ((psRingBuffer->uiCheckpointMask & (1UL << hCheckpoint)) != 0)
+		{
+			uiHeldCount = psRingBuffer->uiPopTotal - psRingBuffer->auiCheckpointPopTotal[hCheckpoint];
+			if (uiHeldCount > psRingBuffer->uiHeldCount)
+			{
+				psRingBuffer->uiHeldCount = uiHeldCount;
+			}
+		}
 	}
 }
+
+#endif	// RING_BUFFER_CHECKPOINTS
@@ -10,6 +10,22 @@
 // 	Ver  	PIC  		Date       	Changes
 // 	----- 	-------- 	---------- 	------------------------------------------------------------------
 // 	1.00  	AnhNH57  	02-07-2013 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Add zero-copy reserve/commit for producers
+// 	1.02  	AnhNH57  	17-10-2026 	Add zero-copy peek/consume for consumers
+// 	1.03  	AnhNH57  	17-10-2026 	Support mirrored data buffers (see RingBufferMirror.h)
+// 	1.04  	AnhNH57  	17-10-2026 	Configurable index width, masked indexing for power-of-two sizes
+// 	1.05  	AnhNH57  	17-10-2026 	Add waiter notification for blocking operations (see RingBufferWait.h)
+// 	1.06  	AnhNH57  	17-10-2026 	Add eventfd readiness notification (see RingBufferEvent.h)
+// 	1.07  	AnhNH57  	17-10-2026 	Add read checkpoints protected from the producer
+// 	1.08  	AnhNH57  	17-10-2026 	Add optional statistics (see RingBufferStats.h)
+// 	1.09  	AnhNH57  	17-10-2026 	Add sampled queue-residency tracing (see RingBufferTrace.h)
+// 	1.10  	AnhNH57  	17-10-2026 	Add built-in locks (see RingBufferLock.h), no platform headers on Linux
+// 	1.11  	AnhNH57  	17-10-2026 	Add BUFFER_ALIGNED for the data storage
+// 	1.12  	AnhNH57  	17-10-2026 	Track the outstanding reservation with its own flag
+// 	1.13  	AnhNH57  	17-10-2026 	Add BufferRewind
+// 	1.14  	AnhNH57  	17-10-2026 	Move BUFFER_ALIGNED to RingBufferConfig.h, no _Alignas for C++
+// 	1.15  	AnhNH57  	17-10-2026 	Add BufferGetAvailableCountUnlocked for polling
+// 	1.16  	AnhNH57  	17-10-2026 	Add BufferPeekConsume to parse and release elements under one lock
 // 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -21,62 +37,250 @@ extern "C" {
 #endif
 
 ////////////////////////////////////////// Include Files /////////////////////////////////////////////
-#include "pic24h_generic.h"
-#include "RTOSHelper.h"
+#include "RingBufferConfig.h"
+#if (RING_BUFFER_PLATFORM_HEADERS == 1)
+	#include "pic24h_generic.h"
+	#include "RTOSHelper.h"
+#else
+	#include "TypeDef.h"
+#endif
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+	#include "RingBufferLock.h"
+#endif
 
 ///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Maximum number of contiguous spans of a region inside the data buffer (the region may wrap around)
+#define BUFFER_SPAN_COUNT			2
+
+// Number of buckets of the queue-residency histogram, see RING_BUFFER_TRACE_SUB_BITS
+#define BUFFER_TRACE_BUCKETS		((RING_BUFFER_TRACE_MAX_BITS - RING_BUFFER_TRACE_SUB_BITS + 1) << RING_BUFFER_TRACE_SUB_BITS)
 
 /////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+#if (RING_BUFFER_PLATFORM_HEADERS == 0)
+// Call-back function with one parameter and no result, as declared by RTOSHelper.h
+typedef void (*CallbackFunction1I0O)(void*);
+#endif
+
+// Element index and element count type, see RING_BUFFER_INDEX_BITS
+#if (RING_BUFFER_INDEX_BITS == 64)
+	typedef UINT64			BUFFER_INDEX;
+#elif (RING_BUFFER_INDEX_BITS == 32)
+	typedef UINT32			BUFFER_INDEX;
+#else
+	typedef UINT16			BUFFER_INDEX;
+#endif
+
+#if (RING_BUFFER_CHECKPOINTS > 32)
+	#error "RING_BUFFER_CHECKPOINTS must not be greater than 32"
+#endif
+
+// Handle of a read checkpoint, see BufferCheckpointCreate
+typedef UINT16				BUFFER_CHECKPOINT;
+
+#if (RING_BUFFER_ENABLE_STATS == 1)
+// Statistics counters of one side of a ring buffer, on their own cache line so that the producer and
+// the consumer never write the same one
+typedef struct S_BUFFER_STATS_SIDE
+{
+	BUFFER_ALIGNED
+	UINT64					uiCallCount;				// Successful calls
+	UINT64					uiElementCount;				// Elements moved by the successful calls
+	UINT64					uiRejectCount;				// Calls rejected, the buffer was full (push) or empty (pop)
+	BUFFER_INDEX			uiHighWaterMark;			// Highest element count after a push (push side only)
+	UINT64					auiLockWait[RING_BUFFER_STATS_BUCKETS];	// Histogram of the lock waits
+
+} SBufferStatsSide;
+#endif
+
+#if (RING_BUFFER_TRACE_INTERVAL > 0)
+// Queue-residency tracing of a ring buffer. The sampled elements are identified by their sequence
+// number, so nothing is added to the data
+typedef struct S_BUFFER_TRACE
+{
+	UINT64					uiPushTotal;				// Elements pushed since initialization
+	UINT64					uiPopTotal;					// Elements popped since initialization
+	UINT64					uiNextSample;				// Sequence number of the next element to sample
+	UINT16					uiPendingHead;				// Oldest queued sample
+	UINT16					uiPendingTail;				// Next free sample slot
+	UINT64					auiPendingSequence[RING_BUFFER_TRACE_SLOTS];	// Sequence of each queued sample
+	UINT64					auiPendingTime[RING_BUFFER_TRACE_SLOTS];		// Push time of each queued sample
+	UINT64					uiSampleCount;				// Samples recorded into the histogram
+	UINT64					uiDropCount;				// Samples dropped, all slots were in use
+	UINT64					auiHistogram[BUFFER_TRACE_BUCKETS];	// Histogram of the residency in ns
+
+} SBufferTrace;
+#endif
+
 // Generic Ring buffer structure
 typedef struct S_RING_BUFFER
 {
 	void*					pvBuffer;					// Data buffer
-	UINT16					uiBufferSize;				// Size of buffer or the total of elements
-	UINT16					uiElementCount;				// The element count of buffer
-	UINT16					uiBufferPopPtr;				// The pointer to start reading
-	UINT16					uiBufferPushPtr;			// The pointer to start writing
-
-	UINT16					uiBKElementCount;			// Backup value of the element count of buffer
-	UINT16					uiBKBufferPopPtr;			// Backup value of the pointer to start reading
-	UINT16					uiBKBufferPushPtr;			// Backup value of the pointer to start writing	
+	BUFFER_INDEX			uiBufferSize;				// Size of buffer or the total of elements
+	BUFFER_INDEX			uiBufferMask;				// uiBufferSize - 1 if it is a power of two, else 0
+	BUFFER_INDEX			uiElementCount;				// The element count of buffer (non power-of-two size only)
+	BUFFER_INDEX			uiBufferPopPtr;				// The pointer to start reading
+	BUFFER_INDEX			uiBufferPushPtr;			// The pointer to start writing
+
+	BUFFER_INDEX			uiBKElementCount;			// Backup value of the element count of buffer
+	BUFFER_INDEX			uiBKBufferPopPtr;			// Backup value of the pointer to start reading
+	BUFFER_INDEX			uiBKBufferPushPtr;			// Backup value of the pointer to start writing	
 	
 	UINT16					uiElementSize;				// Size of each element of the buffer in byte
 	BOOL					bBufferPopEnable;			// Data popping enabling flag
 	BOOL					bBufferPushEnable;			// Data pushing enabling flag
+	BOOL					bBufferReserved;			// A region is reserved by BufferReserve until BufferCommit
+	BUFFER_INDEX			uiReservedCount;			// Element count reserved by BufferReserve
+	BOOL					bBufferMirrored;			// The data buffer is mapped twice back to back
+
+#if (RING_BUFFER_CHECKPOINTS > 0)
+	BUFFER_INDEX			uiPopTotal;					// Elements popped since the last flush, wraps freely
+	BUFFER_INDEX			uiHeldCount;				// Popped elements still held by the oldest checkpoint
+	UINT32					uiCheckpointMask;			// Bit n is set while checkpoint n is live
+	BUFFER_INDEX			auiCheckpointPopPtr[RING_BUFFER_CHECKPOINTS];	// Pop pointer of each checkpoint
+	BUFFER_INDEX			auiCheckpointPopTotal[RING_BUFFER_CHECKPOINTS];	// uiPopTotal of each checkpoint
+#endif
 	
 	CallbackFunction1I0O	callbackLock;				// Call-back function for locking multi-access
 	CallbackFunction1I0O	callbackUnlock;				// Call-back function for unlocking multi-access
 	void*					pvCallbackParam;			// Parameter of the call-back function
+
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+	SBufferLock				sLock;						// Built-in lock, used instead of the call-back functions
+#endif
 	
+#if (RING_BUFFER_ENABLE_WAIT == 1)
+	int						iPushFutex;					// Futex word the blocked pushing callers wait on
+	int						iPushWaiters;				// Number of blocked pushing callers
+	int						iPopFutex;					// Futex word the blocked popping callers wait on
+	int						iPopWaiters;				// Number of blocked popping callers
+#endif
+
+#if (RING_BUFFER_ENABLE_EVENT == 1)
+	int						iPopEventFd;				// eventfd raised when data can be popped
+	int						iPushEventFd;				// eventfd raised when room is freed for pushing
+	int						iPopEventArmed;				// The consumer waits for the pop event
+	int						iPushEventArmed;			// The producer waits for the push event
+#endif
+
+#if (RING_BUFFER_ENABLE_STATS == 1)
+	SBufferStatsSide		sPushStats;					// Statistics of the push side
+	SBufferStatsSide		sPopStats;					// Statistics of the pop side
+#endif
+
+#if (RING_BUFFER_TRACE_INTERVAL > 0)
+	SBufferTrace			sTrace;						// Queue-residency tracing
+#endif
+
 } SRingBuffer;
 
+// Contiguous span of elements inside the data buffer of a ring buffer
+typedef struct S_BUFFER_SPAN
+{
+	void*					pvData;						// Address of the first element of the span
+	BUFFER_INDEX			uiLength;					// Number of elements of the span
+	
+} SBufferSpan;
+
+// Parser given to BufferPeekConsume. It looks at the occupied region and returns the number of
+// elements to be released from its start
+typedef BUFFER_INDEX (*BufferParseFunction)(SBufferSpan asSpan[BUFFER_SPAN_COUNT], void* pvParam);
+
 ///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Lock and unlock accessing to the buffer: the built-in lock if one was selected by BufferInitWithLock,
+// inlined, or else the call-back functions given to BufferInit, if any
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+	#define BUFFER_HAS_LOCK(ps)				(((ps)->sLock.uiPolicy != BUFFER_LOCK_CALLBACK) || ((ps)->callbackLock != NULL))
+	#define BUFFER_LOCK(ps)															\
+			do																		\
+			{																		\
+				if ((ps)->sLock.uiPolicy != BUFFER_LOCK_CALLBACK)					\
+				{																	\
+					BufferLockAcquire(&(ps)->sLock);								\
+				}																	\
+				else if ((ps)->callbackLock)										\
+				{																	\
+					(ps)->callbackLock((ps)->pvCallbackParam);						\
+				}																	\
+			} while (0)
+	#define BUFFER_UNLOCK(ps)														\
+			do																		\
+			{																		\
+				if ((ps)->sLock.uiPolicy != BUFFER_LOCK_CALLBACK)					\
+				{																	\
+					BufferLockRelease(&(ps)->sLock);								\
+				}																	\
+				else if ((ps)->callbackUnlock)										\
+				{																	\
+					(ps)->callbackUnlock((ps)->pvCallbackParam);					\
+				}																	\
+			} while (0)
+#else
+	#define BUFFER_HAS_LOCK(ps)				((ps)->callbackLock != NULL)
+	#define BUFFER_LOCK(ps)															\
+			do																		\
+			{																		\
+				if ((ps)->callbackLock)												\
+				{																	\
+					(ps)->callbackLock((ps)->pvCallbackParam);						\
+				}																	\
+			} while (0)
+	#define BUFFER_UNLOCK(ps)														\
+			do																		\
+			{																		\
+				if ((ps)->callbackUnlock)											\
+				{																	\
+					(ps)->callbackUnlock((ps)->pvCallbackParam);					\
+				}																	\
+			} while (0)
+#endif
 
 ///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
 void			BufferInit(SRingBuffer* psRingBuffer, 
 						   void* pvBuffer, 
-						   UINT16 uiBufferSize, 
+						   BUFFER_INDEX uiBufferSize, 
 						   UINT16 uiElementSize, 
 						   CallbackFunction1I0O callbackLock, 
 						   CallbackFunction1I0O callbackUnlock, 
 						   void* pvCallbackParam);
 
-BOOL 			BufferPushStream(SRingBuffer* psRingBuffer, void* pvStream, UINT16 uiLength);
-UINT16 			BufferPopStream(SRingBuffer* psRingBuffer, void* pvStream, UINT16 uiLength);
+BOOL 			BufferPushStream(SRingBuffer* psRingBuffer, void* pvStream, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferPopStream(SRingBuffer* psRingBuffer, void* pvStream, BUFFER_INDEX uiLength);
 BOOL 			BufferPush(SRingBuffer* psRingBuffer, void* pvData);
-UINT16			BufferPop(SRingBuffer* psRingBuffer, void* pvData);
-BOOL			BufferPushBack(SRingBuffer* psRingBuffer, UINT16 uiPushBackNumber);
+BUFFER_INDEX	BufferPop(SRingBuffer* psRingBuffer, void* pvData);
+BOOL			BufferReserve(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength, SBufferSpan asSpan[BUFFER_SPAN_COUNT]);
+BOOL			BufferCommit(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferPeek(SRingBuffer* psRingBuffer, SBufferSpan asSpan[BUFFER_SPAN_COUNT]);
+BUFFER_INDEX	BufferConsume(SRingBuffer* psRingBuffer, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferPeekConsume(SRingBuffer* psRingBuffer, BufferParseFunction pfnParse, void* pvParam);
+BOOL			BufferPushBack(SRingBuffer* psRingBuffer, BUFFER_INDEX uiPushBackNumber);
 BOOL 			BufferIsPushEnable(SRingBuffer* psRingBuffer);
 BOOL 			BufferIsPopEnable(SRingBuffer* psRingBuffer);
 void			BufferEnablePop(SRingBuffer* psRingBuffer);
 void			BufferDisablePop(SRingBuffer* psRingBuffer);
 void			BufferEnablePush(SRingBuffer* psRingBuffer);
 void			BufferDisablePush(SRingBuffer* psRingBuffer);
-UINT16			BufferGetCount(SRingBuffer* psRingBuffer);
-UINT16			BufferGetAvailableCount(SRingBuffer* psRingBuffer);
+BUFFER_INDEX	BufferGetCount(SRingBuffer* psRingBuffer);
+BUFFER_INDEX	BufferGetAvailableCount(SRingBuffer* psRingBuffer);
+BUFFER_INDEX	BufferGetAvailableCountUnlocked(SRingBuffer* psRingBuffer);
 void			BufferSaveState(SRingBuffer* psRingBuffer);
 void			BufferRestoreState(SRingBuffer* psRingBuffer);
 void 			BufferFlush(SRingBuffer* psRingBuffer);
+BOOL			BufferRewind(SRingBuffer* psRingBuffer);
+
+#if (RING_BUFFER_ENABLE_LOCKS == 1)
+BOOL			BufferInitWithLock(SRingBuffer* psRingBuffer, 
+								   void* pvBuffer, 
+								   BUFFER_INDEX uiBufferSize, 
+								   UINT16 uiElementSize, 
+								   BUFFER_LOCK_POLICY uiLockPolicy);
+void			BufferDeinit(SRingBuffer* psRingBuffer);
+#endif
+
+#if (RING_BUFFER_CHECKPOINTS > 0)
+BOOL			BufferCheckpointCreate(SRingBuffer* psRingBuffer, BUFFER_CHECKPOINT* phCheckpoint);
+BOOL			BufferCheckpointRollback(SRingBuffer* psRingBuffer, BUFFER_CHECKPOINT hCheckpoint);
+BOOL			BufferCheckpointRelease(SRingBuffer* psRingBuffer, BUFFER_CHECKPOINT hCheckpoint);
+#endif
 
 ///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
 
@@ -0,0 +1,453 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBuffer.hpp
+// 	Brief 		: 	Header-only C++ ring buffer specialized at compile time on the element type, the
+//					capacity and the concurrency policy. It uses the same algorithm as the C library
+//					(masked free-running pointers for power-of-two capacities, pointers in the range
+//					[0, 2 * N) otherwise) but the element copies are known to the compiler
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires C++17
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Exception-safe PushStream, locked GetCount with the mutex policy
+// 	1.02  	AnhNH57  	17-10-2026 	Exception-safe PopStream
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_HPP_
+#define _RING_BUFFER_HPP_
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "RingBufferConfig.h"
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Concurrency policy: no synchronization, the buffer is used by one thread only
+struct RingBufferPolicySingle
+{
+	static constexpr bool	kbAtomic	= false;
+
+	struct Lock
+	{
+		void lock() {}
+		void unlock() {}
+	};
+};
+
+// Concurrency policy: one producer thread and one consumer thread, lock-free like SRingBufferSPSC
+struct RingBufferPolicySPSC
+{
+	static constexpr bool	kbAtomic	= true;
+
+	struct Lock
+	{
+		void lock() {}
+		void unlock() {}
+	};
+};
+
+// Concurrency policy: any number of threads, every operation is serialized by a mutex like the
+// callbackLock/callbackUnlock pair of SRingBuffer
+struct RingBufferPolicyMutex
+{
+	static constexpr bool	kbAtomic	= false;
+
+	using Lock = std::mutex;
+};
+
+// Ring buffer of N elements of type T.
+// Trivially copyable types are copied with constant-size memcpy. Other types are constructed in
+// place with placement new, moved out on popping and destroyed in the buffer
+template <typename T, std::size_t N, typename Policy = RingBufferPolicySingle>
+class CRingBuffer
+{
+	static_assert(N > 0, "The capacity must not be zero");
+
+public:
+	CRingBuffer() = default;
+	CRingBuffer(const CRingBuffer&) = delete;
+	CRingBuffer& operator=(const CRingBuffer&) = delete;
+
+	~CRingBuffer()
+	{
+		Flush();
+	}
+
+	// -----------------------------------------------------------------------------------------------
+	//	@brief	: 	Construct an element in place at the end of the buffer
+	//	@return	: 	true if pushing successfully and vice versa
+	// -----------------------------------------------------------------------------------------------
+	template <typename... Args>
+	bool Emplace(Args&&... args)
+	{
+		std::lock_guard<typename Policy::Lock>	guard(m_lock);
+		std::size_t								uiPushPtr	= Load(m_uiBufferPushPtr, std::memory_order_relaxed);
+
+		if (!HasRoom(uiPushPtr, 1))
+		{
+			return false;
+		}
+
+		::new (static_cast<void*>(SlotAddress(uiPushPtr))) T(std::forward<Args>(args)...);
+
+		// Publish the new element to the pop side
+		Store(m_uiBufferPushPtr, Advance(uiPushPtr, 1), std::memory_order_release);
+
+		return true;
+	}
+
+	// -----------------------------------------------------------------------------------------------
+	//	@brief	: 	Push a data element into the buffer
+	//	@return	: 	true if pushing successfully and vice versa
+	// -----------------------------------------------------------------------------------------------
+	bool Push(const T& tData)
+	{
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			std::lock_guard<typename Policy::Lock>	guard(m_lock);
+			std::size_t								uiPushPtr	= Load(m_uiBufferPushPtr, std::memory_order_relaxed);
+
+			if (!HasRoom(uiPushPtr, 1))
+			{
+				return false;
+			}
+
+			std::memcpy(SlotAddress(uiPushPtr), &tData, sizeof(T));
+			Store(m_uiBufferPushPtr, Advance(uiPushPtr, 1), std::memory_order_release);
+
+			return true;
+		}
+		else
+		{
+			return Emplace(tData);
+		}
+	}
+
+	bool Push(T&& tData)
+	{
+		return Emplace(std::move(tData));
+	}
+
+	// -----------------------------------------------------------------------------------------------
+	//	@brief	: 	Pop out a data element from the buffer
+	//	@return	: 	true if popping successfully, false if the buffer is empty
+	// -----------------------------------------------------------------------------------------------
+	bool Pop(T& tData)
+	{
+		std::lock_guard<typename Policy::Lock>	guard(m_lock);
+		std::size_t								uiPopPtr	= Load(m_uiBufferPopPtr, std::memory_order_relaxed);
+		T*										ptElement	= NULL;
+
+		if (AvailableToPop(uiPopPtr, 1) == 0)
+		{
+			return false;
+		}
+
+		ptElement = SlotAddress(uiPopPtr);
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			std::memcpy(&tData, ptElement, sizeof(T));
+		}
+		else
+		{
+			tData = std::move(*ptElement);
+			ptElement->~T();
+		}
+
+		// Hand the freed element back to the push side
+		Store(m_uiBufferPopPtr, Advance(uiPopPtr, 1), std::memory_order_release);
+
+		return true;
+	}
+
+	// -----------------------------------------------------------------------------------------------
+	//	@brief	: 	Push a stream into the buffer. The stream is pushed entirely or not at all
+	//	@return	: 	true if pushing successfully and vice versa
+	//	@note	:	If copying an element throws, the elements already copied are destroyed and the
+	//				exception is rethrown, the buffer is left unchanged
+	// -----------------------------------------------------------------------------------------------
+	bool PushStream(const T* ptStream, std::size_t uiLength)
+	{
+		std::lock_guard<typename Policy::Lock>	guard(m_lock);
+		std::size_t								uiPushPtr	= Load(m_uiBufferPushPtr, std::memory_order_relaxed);
+		std::size_t								uiSlot		= Slot(uiPushPtr);
+		std::size_t								uiFirst		= N - uiSlot;
+		std::size_t								uiIndex		= 0;
+
+		if (!HasRoom(uiPushPtr, uiLength))
+		{
+			return false;
+		}
+
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			// If the region wraps around the end of the buffer then we need to copy twice
+			if (uiLength > uiFirst)
+			{
+				std::memcpy(SlotAddress(uiPushPtr), ptStream, uiFirst * sizeof(T));
+				std::memcpy(SlotAddress(0), ptStream + uiFirst, (uiLength - uiFirst) * sizeof(T));
+			}
+			else
+			{
+				std::memcpy(SlotAddress(uiPushPtr), ptStream, uiLength * sizeof(T));
+			}
+		}
+		else
+		{
+			try
+			{
+				for (uiIndex = 0; uiIndex < uiLength; uiIndex++)
+				{
+					::new (static_cast<void*>(SlotAddress(Advance(uiPushPtr, uiIndex)))) T(ptStream[uiIndex]);
+				}
+			}
+			catch (...)
+			{
+				// Nothing is published yet, undo the elements constructed so far
+				while (uiIndex > 0)
+				{
+					uiIndex--;
+					SlotAddress(Advance(uiPushPtr, uiIndex))->~T();
+				}
+				throw;
+			}
+		}
+
+		Store(m_uiBufferPushPtr, Advance(uiPushPtr, uiLength), std::memory_order_release);
+
+		return true;
+	}
+
+	// -----------------------------------------------------------------------------------------------
+	//	@brief	: 	Pop a stream from the buffer
+	//	@return	: 	The number of elements popped out actually
+	// -----------------------------------------------------------------------------------------------
+	std::size_t PopStream(T* ptStream, std::size_t uiLength)
+	{
+		std::lock_guard<typename Policy::Lock>	guard(m_lock);
+		std::size_t								uiPopPtr	= Load(m_uiBufferPopPtr, std::memory_order_relaxed);
+		std::size_t								uiPopCount	= AvailableToPop(uiPopPtr, uiLength);
+		std::size_t								uiFirst		= N - Slot(uiPopPtr);
+		std::size_t								uiIndex		= 0;
+		T*										ptElement	= NULL;
+
+		// Limit length of data stream will be popped
+		if (uiLength < uiPopCount)
+		{
+			uiPopCount = uiLength;
+		}
+
+		if constexpr (std::is_trivially_copyable<T>::value)
+		{
+			// If the region wraps around the end of the buffer then we need to copy twice
+			if (uiPopCount > uiFirst)
+			{
+				std::memcpy(ptStream, SlotAddress(uiPopPtr), uiFirst * sizeof(T));
+				std::memcpy(ptStream + uiFirst, SlotAddress(0), (uiPopCount - uiFirst) * sizeof(T));
+			}
+			else
+			{
+				std::memcpy(ptStream, SlotAddress(uiPopPtr), uiPopCount * sizeof(T));
+			}
+		}
+		else
+		{
+			try
+			{
+				for (uiIndex = 0; uiIndex < uiPopCount; uiIndex++)
+				{
+					ptElement			= SlotAddress(Advance(uiPopPtr, uiIndex));
+					ptStream[uiIndex]	= std::move(*ptElement);
+					ptElement->~T();
+				}
+			}
+			catch (...)
+			{
+				// The elements moved out so far are destroyed already, hand them back to the push side.
+				// The one which failed stays in the buffer
+				Store(m_uiBufferPopPtr, Advance(uiPopPtr, uiIndex), std::memory_order_release);
+				throw;
+			}
+		}
+
+		Store(m_uiBufferPopPtr, Advance(uiPopPtr, uiPopCount), std::memory_order_release);
+
+		return uiPopCount;
+	}
+
+	// -----------------------------------------------------------------------------------------------
+	//	@brief	: 	Remove every element from the buffer
+	//	@note	:	Must be called from the pop side
+	// -----------------------------------------------------------------------------------------------
+	void Flush()
+	{
+		std::lock_guard<typename Policy::Lock>	guard(m_lock);
+		std::size_t								uiPopPtr	= Load(m_uiBufferPopPtr, std::memory_order_relaxed);
+		std::size_t								uiPopCount	= AvailableToPop(uiPopPtr, N);
+
+		if constexpr (!std::is_trivially_destructible<T>::value)
+		{
+			for (std::size_t uiIndex = 0; uiIndex < uiPopCount; uiIndex++)
+			{
+				SlotAddress(Advance(uiPopPtr, uiIndex))->~T();
+			}
+		}
+
+		Store(m_uiBufferPopPtr, Advance(uiPopPtr, uiPopCount), std::memory_order_release);
+	}
+
+	// -----------------------------------------------------------------------------------------------
+	//	@brief	: 	Get the element count of the buffer
+	//	@note	:	With a concurrent policy the result is a snapshot. The pointers are plain variables
+	//				unless the policy is lock-free, so they are read under the lock
+	// -----------------------------------------------------------------------------------------------
+	std::size_t GetCount() const
+	{
+		if constexpr (Policy::kbAtomic)
+		{
+			std::size_t	uiPopPtr	= Load(m_uiBufferPopPtr, std::memory_order_acquire);
+			std::size_t	uiPushPtr	= Load(m_uiBufferPushPtr, std::memory_order_acquire);
+
+			return Distance(uiPushPtr, uiPopPtr);
+		}
+		else
+		{
+			std::lock_guard<typename Policy::Lock>	guard(m_lock);
+
+			return Distance(m_uiBufferPushPtr, m_uiBufferPopPtr);
+		}
+	}
+
+	std::size_t GetAvailableCount() const
+	{
+		return N - GetCount();
+	}
+
+	static constexpr std::size_t GetSize()
+	{
+		return N;
+	}
+
+private:
+	static constexpr bool	kbPowerOfTwo	= ((N & (N - 1)) == 0);
+
+	using Index = typename std::conditional<Policy::kbAtomic, std::atomic<std::size_t>, std::size_t>::type;
+
+	// Number of elements between the pop pointer and the push pointer
+	static constexpr std::size_t Distance(std::size_t uiPushPtr, std::size_t uiPopPtr)
+	{
+		if constexpr (kbPowerOfTwo)
+		{
+			return uiPushPtr - uiPopPtr;
+		}
+		else
+		{
+			return (uiPushPtr >= uiPopPtr) ? (uiPushPtr - uiPopPtr) : (uiPushPtr + 2 * N - uiPopPtr);
+		}
+	}
+
+	// Index of the element in the storage which a push or pop pointer refers to
+	static constexpr std::size_t Slot(std::size_t uiPtr)
+	{
+		if constexpr (kbPowerOfTwo)
+		{
+			return uiPtr & (N - 1);
+		}
+		else
+		{
+			return (uiPtr >= N) ? (uiPtr - N) : uiPtr;
+		}
+	}
+
+	// Move a push or pop pointer forward by uiLength elements
+	static constexpr std::size_t Advance(std::size_t uiPtr, std::size_t uiLength)
+	{
+		if constexpr (kbPowerOfTwo)
+		{
+			return uiPtr + uiLength;
+		}
+		else
+		{
+			uiPtr += uiLength;
+			return (uiPtr >= 2 * N) ? (uiPtr - 2 * N) : uiPtr;
+		}
+	}
+
+	static std::size_t Load(const Index& uiIndex, std::memory_order eOrder)
+	{
+		if constexpr (Policy::kbAtomic)
+		{
+			return uiIndex.load(eOrder);
+		}
+		else
+		{
+			(void)eOrder;
+			return uiIndex;
+		}
+	}
+
+	static void Store(Index& uiIndex, std::size_t uiValue, std::memory_order eOrder)
+	{
+		if constexpr (Policy::kbAtomic)
+		{
+			uiIndex.store(uiValue, eOrder);
+		}
+		else
+		{
+			(void)eOrder;
+			uiIndex = uiValue;
+		}
+	}
+
+	T* SlotAddress(std::size_t uiPtr)
+	{
+		return std::launder(reinterpret_cast<T*>(m_aucStorage + Slot(uiPtr) * sizeof(T)));
+	}
+
+	// Check the room for uiLength elements, reloading the pop pointer only when the cached one is
+	// not enough (push side)
+	bool HasRoom(std::size_t uiPushPtr, std::size_t uiLength)
+	{
+		if (uiLength > N - Distance(uiPushPtr, m_uiCachedPopPtr))
+		{
+			m_uiCachedPopPtr = Load(m_uiBufferPopPtr, std::memory_order_acquire);
+			return (uiLength <= N - Distance(uiPushPtr, m_uiCachedPopPtr));
+		}
+
+		return true;
+	}
+
+	// Get the element count, reloading the push pointer only when the cached one cannot satisfy
+	// uiLength elements (pop side)
+	std::size_t AvailableToPop(std::size_t uiPopPtr, std::size_t uiLength)
+	{
+		if (Distance(m_uiCachedPushPtr, uiPopPtr) < uiLength)
+		{
+			m_uiCachedPushPtr = Load(m_uiBufferPushPtr, std::memory_order_acquire);
+		}
+
+		return Distance(m_uiCachedPushPtr, uiPopPtr);
+	}
+
+	// Owned by the push side
+	alignas(RING_BUFFER_CACHE_LINE_SIZE) Index	m_uiBufferPushPtr	{0};
+	std::size_t									m_uiCachedPopPtr	= 0;
+
+	// Owned by the pop side
+	alignas(RING_BUFFER_CACHE_LINE_SIZE) Index	m_uiBufferPopPtr	{0};
+	std::size_t									m_uiCachedPushPtr	= 0;
+
+	alignas(RING_BUFFER_CACHE_LINE_SIZE) mutable typename Policy::Lock	m_lock;
+	alignas(RING_BUFFER_CACHE_LINE_SIZE) alignas(T) unsigned char	m_aucStorage[N * sizeof(T)];
+};
+
+#endif	// _RING_BUFFER_HPP_
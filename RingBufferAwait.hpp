@@ -0,0 +1,385 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferAwait.hpp
+// 	Brief 		: 	C++20 coroutine awaitables over SRingBuffer. co_await on a push suspends the coroutine
+//					while the buffer is full and co_await on a pop while it is empty; the operation of
+//					the opposite side completes the suspended one and hands its coroutine to an executor
+//					call-back, so that many producer and consumer tasks share a few threads without
+//					spinning or blocking in the kernel
+//	Author 		: 	AnhNH57
+//  Note 		: 	C++20 only, header only. All pushes and pops of the buffer must go through these
+//					awaitables (or be followed by BufferAwaitWake), otherwise the waiters are not woken
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Keep the waiters in order, fence before checking for waiters
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_AWAIT_HPP_
+#define _RING_BUFFER_AWAIT_HPP_
+
+#if (__cplusplus < 202002L)
+	#error "RingBufferAwait.hpp requires C++20"
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <atomic>
+#include <coroutine>
+#include <mutex>
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Executor hook: make a woken coroutine run, e.g. post it to the queue of the executor. It is called
+// by the thread whose push or pop completed the operation of the coroutine, without any lock held
+typedef void (*BufferAwaitSchedule)(void* pvParam, std::coroutine_handle<> hCoroutine);
+
+// Coroutine suspended on a full or an empty buffer, stored in its awaiter
+typedef struct S_BUFFER_AWAIT_WAITER
+{
+	struct S_BUFFER_AWAIT_WAITER*	psNext;				// Next waiter of the list
+	std::coroutine_handle<>			hCoroutine;			// The coroutine
+	void*							pvData;				// Data stream to be pushed or popped
+	BUFFER_INDEX					uiLength;			// Length of the data stream
+	BUFFER_INDEX					uiResult;			// Elements pushed or popped for the coroutine
+
+} SBufferAwaitWaiter;
+
+// FIFO list of waiters
+typedef struct S_BUFFER_AWAIT_LIST
+{
+	SBufferAwaitWaiter*		psHead;						// Oldest waiter
+	SBufferAwaitWaiter*		psTail;						// Newest waiter
+
+} SBufferAwaitList;
+
+// Ring buffer with awaitable push and pop
+typedef struct S_RING_BUFFER_AWAIT
+{
+	SRingBuffer*			psRingBuffer;				// The ring buffer
+	BufferAwaitSchedule		pfnSchedule;				// Executor hook, NULL to resume inline
+	void*					pvScheduleParam;			// Parameter of the executor hook
+	std::mutex				sMutex;						// Protects the lists
+	std::atomic<UINT32>		uiPushWaiterCount;			// Waiters of sPushWaiters, read without the mutex
+	std::atomic<UINT32>		uiPopWaiterCount;			// Waiters of sPopWaiters, read without the mutex
+	SBufferAwaitList		sPushWaiters;				// Coroutines waiting for room
+	SBufferAwaitList		sPopWaiters;				// Coroutines waiting for elements
+
+} SRingBufferAwait;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Append a waiter to a list
+//
+//	@param	: 	psList is the list
+//	@param	: 	psWaiter is the waiter
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static inline void BufferAwaitAppend(SBufferAwaitList* psList, SBufferAwaitWaiter* psWaiter)
+{
+	psWaiter->psNext = NULL;
+	if (psList->psTail == NULL)
+	{
+		psList->psHead = psWaiter;
+	}
+	else
+	{
+		psList->psTail->psNext = psWaiter;
+	}
+	psList->psTail = psWaiter;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Remove the oldest waiter of a list
+//
+//	@param	: 	psList is the list, not empty
+//	@return	: 	The waiter
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static inline SBufferAwaitWaiter* BufferAwaitTake(SBufferAwaitList* psList)
+{
+	SBufferAwaitWaiter*		psWaiter	= psList->psHead;
+
+	psList->psHead = psWaiter->psNext;
+	if (psList->psHead == NULL)
+	{
+		psList->psTail = NULL;
+	}
+
+	return psWaiter;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize the awaitables of a ring buffer
+//
+//	@param	: 	psAwait is the structure of the awaitables
+//	@param	: 	psRingBuffer is the ring buffer, already initialized. If the coroutines run on more
+//				than one thread it must have a lock
+//	@param	: 	pfnSchedule is the executor hook, NULL to resume the woken coroutines inline
+//	@param	: 	pvScheduleParam is the parameter of the executor hook
+//	@return	: 	Void
+//	@note	:	Resuming inline runs the woken coroutine on the stack of the one which woke it. An
+//				executor posting the coroutine to its run queue avoids the nesting
+// ---------------------------------------------------------------------------------------------------
+static inline void BufferAwaitInit(SRingBufferAwait* psAwait, SRingBuffer* psRingBuffer, BufferAwaitSchedule pfnSchedule, void* pvScheduleParam)
+{
+	psAwait->psRingBuffer			= psRingBuffer;
+	psAwait->pfnSchedule			= pfnSchedule;
+	psAwait->pvScheduleParam		= pvScheduleParam;
+	psAwait->uiPushWaiterCount.store(0);
+	psAwait->uiPopWaiterCount.store(0);
+	psAwait->sPushWaiters.psHead	= NULL;
+	psAwait->sPushWaiters.psTail	= NULL;
+	psAwait->sPopWaiters.psHead		= NULL;
+	psAwait->sPopWaiters.psTail		= NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Complete the operations of the waiters which the buffer can serve now, and schedule
+//				their coroutines
+//
+//	@param	: 	psAwait is the structure of the awaitables
+//	@return	: 	Void
+//	@note	:	Called after every successful push or pop of the awaitables, and to be called after a
+//				push or pop made directly on the ring buffer. A completed push may serve a pop waiter
+//				and the other way round, so both lists are served until neither makes progress
+// ---------------------------------------------------------------------------------------------------
+static inline void BufferAwaitWake(SRingBufferAwait* psAwait)
+{
+	SBufferAwaitList		sReady		= { NULL, NULL };
+	SBufferAwaitWaiter*		psWaiter	= NULL;
+	BOOL					bProgress	= TRUE;
+
+	// The push or pop just made released the lock of the buffer only. Order it before the check, so
+	// that either a waiter counted meanwhile is seen here, or its retry sees the push or pop
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if ((psAwait->uiPushWaiterCount.load() == 0) && (psAwait->uiPopWaiterCount.load() == 0))
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex>	sGuard(psAwait->sMutex);
+
+		while (bProgress == TRUE)
+		{
+			bProgress = FALSE;
+
+			while ((psAwait->sPushWaiters.psHead != NULL) &&
+				   (BufferPushStream(psAwait->psRingBuffer, psAwait->sPushWaiters.psHead->pvData, psAwait->sPushWaiters.psHead->uiLength) == TRUE))
+			{
+				psWaiter			= BufferAwaitTake(&psAwait->sPushWaiters);
+				psWaiter->uiResult	= psWaiter->uiLength;
+				BufferAwaitAppend(&sReady, psWaiter);
+				psAwait->uiPushWaiterCount.fetch_sub(1);
+				bProgress			= TRUE;
+			}
+
+			while ((psAwait->sPopWaiters.psHead != NULL) &&
+				   ((psAwait->sPopWaiters.psHead->uiResult = BufferPopStream(psAwait->psRingBuffer, psAwait->sPopWaiters.psHead->pvData, psAwait->sPopWaiters.psHead->uiLength)) > 0))
+			{
+				psWaiter			= BufferAwaitTake(&psAwait->sPopWaiters);
+				BufferAwaitAppend(&sReady, psWaiter);
+				psAwait->uiPopWaiterCount.fetch_sub(1);
+				bProgress			= TRUE;
+			}
+		}
+	}
+
+	// The waiter lives in the frame of its coroutine, which may be gone once it has run
+	while (sReady.psHead != NULL)
+	{
+		psWaiter = BufferAwaitTake(&sReady);
+		if (psAwait->pfnSchedule != NULL)
+		{
+			psAwait->pfnSchedule(psAwait->pvScheduleParam, psWaiter->hCoroutine);
+		}
+		else
+		{
+			psWaiter->hCoroutine.resume();
+		}
+	}
+}
+
+// Awaiter of a push: co_await gives TRUE once the whole stream is pushed, FALSE at once if the stream
+// is longer than the buffer
+struct SBufferPushAwaiter
+{
+	SRingBufferAwait*		psAwait;					// The awaitables of the ring buffer
+	SBufferAwaitWaiter		sWaiter;					// The waiter, while suspended
+	BOOL					bRejected;					// The stream can never be pushed
+
+	bool await_ready(void)
+	{
+		SRingBuffer*	psRingBuffer	= psAwait->psRingBuffer;
+
+		if (sWaiter.uiLength > psRingBuffer->uiBufferSize)
+		{
+			bRejected = TRUE;
+			return true;
+		}
+
+		// Do not overtake the coroutines already waiting for room
+		if ((psAwait->uiPushWaiterCount.load() == 0) &&
+			(BufferPushStream(psRingBuffer, sWaiter.pvData, sWaiter.uiLength) == TRUE))
+		{
+			sWaiter.uiResult = sWaiter.uiLength;
+			BufferAwaitWake(psAwait);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool await_suspend(std::coroutine_handle<> hCoroutine)
+	{
+		sWaiter.hCoroutine = hCoroutine;
+
+		{
+			std::lock_guard<std::mutex>	sGuard(psAwait->sMutex);
+
+			// Counted before trying again, so that a pop made meanwhile either is seen by the retry or
+			// sees the waiter. Only the first waiter tries, the others queue up behind it
+			psAwait->uiPushWaiterCount.fetch_add(1);
+			if ((psAwait->sPushWaiters.psHead != NULL) ||
+				(BufferPushStream(psAwait->psRingBuffer, sWaiter.pvData, sWaiter.uiLength) == FALSE))
+			{
+				BufferAwaitAppend(&psAwait->sPushWaiters, &sWaiter);
+				return true;
+			}
+			psAwait->uiPushWaiterCount.fetch_sub(1);
+		}
+
+		sWaiter.uiResult = sWaiter.uiLength;
+		BufferAwaitWake(psAwait);
+
+		return false;
+	}
+
+	BOOL await_resume(void)
+	{
+		return ((bRejected == FALSE) && (sWaiter.uiResult == sWaiter.uiLength)) ? TRUE : FALSE;
+	}
+};
+
+// Awaiter of a pop: co_await gives the number of elements popped, at least 1
+struct SBufferPopAwaiter
+{
+	SRingBufferAwait*		psAwait;					// The awaitables of the ring buffer
+	SBufferAwaitWaiter		sWaiter;					// The waiter, while suspended
+
+	bool await_ready(void)
+	{
+		if (sWaiter.uiLength == 0)
+		{
+			return true;
+		}
+
+		// Do not overtake the coroutines already waiting for elements
+		if (psAwait->uiPopWaiterCount.load() != 0)
+		{
+			return false;
+		}
+
+		sWaiter.uiResult = BufferPopStream(psAwait->psRingBuffer, sWaiter.pvData, sWaiter.uiLength);
+		if (sWaiter.uiResult > 0)
+		{
+			BufferAwaitWake(psAwait);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool await_suspend(std::coroutine_handle<> hCoroutine)
+	{
+		sWaiter.hCoroutine = hCoroutine;
+
+		{
+			std::lock_guard<std::mutex>	sGuard(psAwait->sMutex);
+
+			// Only the first waiter tries, the others queue up behind it
+			psAwait->uiPopWaiterCount.fetch_add(1);
+			if ((psAwait->sPopWaiters.psHead != NULL) ||
+				((sWaiter.uiResult = BufferPopStream(psAwait->psRingBuffer, sWaiter.pvData, sWaiter.uiLength)) == 0))
+			{
+				BufferAwaitAppend(&psAwait->sPopWaiters, &sWaiter);
+				return true;
+			}
+			psAwait->uiPopWaiterCount.fetch_sub(1);
+		}
+
+		BufferAwaitWake(psAwait);
+
+		return false;
+	}
+
+	BUFFER_INDEX await_resume(void)
+	{
+		return sWaiter.uiResult;
+	}
+};
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer, suspending the coroutine while there is not enough room
+//
+//	@param	: 	psAwait is the structure of the awaitables
+//	@param	: 	pvStream is the data stream to be pushed into the buffer, kept valid until resumed
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	Awaiter, co_await gives TRUE if pushing successfully and vice versa
+//	@note	:	BOOL bResult = co_await BufferAwaitPushStream(&sAwait, aucData, uiLength);
+// ---------------------------------------------------------------------------------------------------
+static inline SBufferPushAwaiter BufferAwaitPushStream(SRingBufferAwait* psAwait, void* pvStream, BUFFER_INDEX uiLength)
+{
+	return SBufferPushAwaiter{ psAwait, { NULL, {}, pvStream, uiLength, 0 }, FALSE };
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer, suspending the coroutine while it is empty
+//
+//	@param	: 	psAwait is the structure of the awaitables
+//	@param	: 	pvStream receives the data stream, kept valid until resumed
+//	@param	:	uiLength is the maximum length of data stream
+//	@return	: 	Awaiter, co_await gives the number of elements popped out actually
+//	@note	:	BUFFER_INDEX uiCount = co_await BufferAwaitPopStream(&sAwait, aucData, uiLength);
+// ---------------------------------------------------------------------------------------------------
+static inline SBufferPopAwaiter BufferAwaitPopStream(SRingBufferAwait* psAwait, void* pvStream, BUFFER_INDEX uiLength)
+{
+	return SBufferPopAwaiter{ psAwait, { NULL, {}, pvStream, uiLength, 0 } };
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer, suspending the coroutine while it is full
+//
+//	@param	: 	psAwait is the structure of the awaitables
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	Awaiter, co_await gives TRUE if pushing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static inline SBufferPushAwaiter BufferAwaitPush(SRingBufferAwait* psAwait, void* pvData)
+{
+	return BufferAwaitPushStream(psAwait, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from ring buffer, suspending the coroutine while it is empty
+//
+//	@param	: 	psAwait is the structure of the awaitables
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	Awaiter, co_await gives the number of elements popped out actually
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static inline SBufferPopAwaiter BufferAwaitPop(SRingBufferAwait* psAwait, void* pvData)
+{
+	return BufferAwaitPopStream(psAwait, pvData, 1);
+}
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+#endif	// _RING_BUFFER_AWAIT_HPP_
@@ -0,0 +1,324 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferBroadcast.c
+// 	Brief 		: 	Single-producer broadcast ring buffer. Every element is stored once and read by
+//					every consumer through its own read cursor. The producer is held back only by the
+//					slowest active cursor, and consumers can join and leave at any time
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <string.h>
+#include "RingBufferBroadcast.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Index of the element in the data buffer which a push pointer or a read cursor refers to
+#define BROADCAST_SLOT(ps, uiPtr)			((UINT16)((uiPtr) & (ps)->uiBufferMask))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static UINT64	BufferBroadcastGate(SRingBufferBroadcast* psRingBuffer, UINT64 uiPushPtr);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a broadcast ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvBuffer is the data storage area
+//	@param	:	uiBufferSize is the length of buffer or the number of elements in the buffer. It must
+//				be a power of two
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	Must be called before the producer or any consumer thread is started
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferBroadcastInit(SRingBufferBroadcast* psRingBuffer,
+						 void* pvBuffer,
+						 UINT16 uiBufferSize,
+						 UINT16 uiElementSize)
+{
+	UINT16	uiIndex	= 0;
+
+	// The pointers are wrapped by masking, so the size must be a power of two
+	if ((uiBufferSize == 0) || ((uiBufferSize & (uiBufferSize - 1)) != 0))
+	{
+		return FALSE;
+	}
+
+	// Initialize data for the Ring buffer structure
+	psRingBuffer->pvBuffer			= pvBuffer;
+	psRingBuffer->uiBufferSize		= uiBufferSize;
+	psRingBuffer->uiBufferMask		= uiBufferSize - 1;
+	psRingBuffer->uiElementSize		= uiElementSize;
+
+	atomic_init(&psRingBuffer->uiBufferPushPtr, 0);
+	psRingBuffer->uiCachedGatePtr	= 0;
+
+	// Nobody has joined yet
+	for (uiIndex = 0; uiIndex < RING_BUFFER_BROADCAST_READERS; uiIndex++)
+	{
+		atomic_init(&psRingBuffer->asCursor[uiIndex].uiBufferPopPtr, BUFFER_BROADCAST_CURSOR_FREE);
+		psRingBuffer->asCursor[uiIndex].uiCachedPushPtr = 0;
+	}
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Register a new consumer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	puiReader receives the reader number to be passed to the popping functions
+//	@return	: 	TRUE if joining successfully, FALSE if RING_BUFFER_BROADCAST_READERS readers have
+//				already joined
+//	@note	:	The new reader sees the elements pushed from now on. It may be called from any thread
+//				while the producer is running
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferBroadcastJoin(SRingBufferBroadcast* psRingBuffer, UINT16* puiReader)
+{
+	SBufferBroadcastCursor*	psCursor	= NULL;
+	UINT64					uiExpected	= 0;
+	UINT64					uiPushPtr	= 0;
+	UINT16					uiIndex		= 0;
+
+	for (uiIndex = 0; uiIndex < RING_BUFFER_BROADCAST_READERS; uiIndex++)
+	{
+		psCursor	= &psRingBuffer->asCursor[uiIndex];
+		uiExpected	= BUFFER_BROADCAST_CURSOR_FREE;
+		uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+
+		// Claim the free reader slot and show the producer where the reader starts
+		if (atomic_compare_exchange_strong(&psCursor->uiBufferPopPtr, &uiExpected, uiPushPtr))
+		{
+			// The producer may have computed its gate before it could see the cursor, but not before
+			// it published the current push pointer. Starting there keeps the reader clear of
+			// anything the producer can write with that gate
+			atomic_thread_fence(memory_order_seq_cst);
+			uiPushPtr = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+			atomic_store_explicit(&psCursor->uiBufferPopPtr, uiPushPtr, memory_order_release);
+
+			psCursor->uiCachedPushPtr	= uiPushPtr;
+			*puiReader					= uiIndex;
+
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Unregister a consumer, the producer is no longer held back by it
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiReader is the reader number given by BufferBroadcastJoin
+//	@return	: 	Void
+//	@note	:	Must be called from the consumer thread of the reader
+// ---------------------------------------------------------------------------------------------------
+void BufferBroadcastLeave(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader)
+{
+	atomic_store_explicit(&psRingBuffer->asCursor[uiReader].uiBufferPopPtr, BUFFER_BROADCAST_CURSOR_FREE, memory_order_release);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer. The stream is pushed entirely or not at all
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully, FALSE if the slowest reader has not freed enough room
+//	@note	:	Must be called from the producer only. Without any reader the elements are dropped
+//				for nobody and pushing always succeeds
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferBroadcastPushStream(SRingBufferBroadcast* psRingBuffer, void* pvStream, UINT16 uiLength)
+{
+	UINT64	uiPushPtr		= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+	UINT16	uiSlot			= BROADCAST_SLOT(psRingBuffer, uiPushPtr);
+	UINT16	uiFirstLength	= psRingBuffer->uiBufferSize - uiSlot;
+	UCHAR*	pvBuffer		= (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize;
+
+	// Only scan the read cursors when the cached gate says there is not enough room
+	if ((uiPushPtr - psRingBuffer->uiCachedGatePtr + uiLength) > psRingBuffer->uiBufferSize)
+	{
+		psRingBuffer->uiCachedGatePtr = BufferBroadcastGate(psRingBuffer, uiPushPtr);
+		if ((uiPushPtr - psRingBuffer->uiCachedGatePtr + uiLength) > psRingBuffer->uiBufferSize)
+		{
+			return FALSE;
+		}
+	}
+
+	// If the pushing address is out of address range of the buffer then we need to push twice
+	if (uiLength > uiFirstLength)
+	{
+		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy(psRingBuffer->pvBuffer, (UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->uiElementSize * (uiLength - uiFirstLength));
+	}
+	else
+	{
+		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiLength);
+	}
+
+	// Publish the new elements to every reader
+	atomic_store_explicit(&psRingBuffer->uiBufferPushPtr, uiPushPtr + uiLength, memory_order_release);
+
+	return TRUE;	// Push successfully
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer for one reader
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiReader is the reader number given by BufferBroadcastJoin
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Must be called from the consumer thread of the reader. The elements stay in the buffer
+//				for the other readers
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferBroadcastPopStream(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader, void* pvStream, UINT16 uiLength)
+{
+	SBufferBroadcastCursor*	psCursor		= &psRingBuffer->asCursor[uiReader];
+	UINT64					uiPopPtr		= atomic_load_explicit(&psCursor->uiBufferPopPtr, memory_order_relaxed);
+	UINT64					uiPopCount		= psCursor->uiCachedPushPtr - uiPopPtr;
+	UINT16					uiSlot			= BROADCAST_SLOT(psRingBuffer, uiPopPtr);
+	UINT16					uiFirstLength	= psRingBuffer->uiBufferSize - uiSlot;
+	UCHAR*					pvBuffer		= (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize;
+
+	// Only reload the push pointer when the cached one cannot satisfy the request
+	if (uiPopCount < uiLength)
+	{
+		psCursor->uiCachedPushPtr = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+		uiPopCount = psCursor->uiCachedPushPtr - uiPopPtr;
+		if (uiPopCount == 0)
+		{
+			return 0;
+		}
+	}
+
+	// Limit length of data stream will be popped
+	if (uiLength < uiPopCount)
+	{
+		uiPopCount = uiLength;
+	}
+
+	// If the popping address is out of address range of the buffer then we need to pop twice
+	if (uiPopCount > uiFirstLength)
+	{
+		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy((UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->pvBuffer, psRingBuffer->uiElementSize * (uiPopCount - uiFirstLength));
+	}
+	else
+	{
+		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiPopCount);
+	}
+
+	// Let the producer reuse the elements once every reader is past them
+	atomic_store_explicit(&psCursor->uiBufferPopPtr, uiPopPtr + uiPopCount, memory_order_release);
+
+	return (UINT16)uiPopCount;	// Return the number of elements popped out actually
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	Must be called from the producer only
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferBroadcastPush(SRingBufferBroadcast* psRingBuffer, void* pvData)
+{
+	return BufferBroadcastPushStream(psRingBuffer, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from ring buffer for one reader
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiReader is the reader number given by BufferBroadcastJoin
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Must be called from the consumer thread of the reader
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferBroadcastPop(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader, void* pvData)
+{
+	return BufferBroadcastPopStream(psRingBuffer, uiReader, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the number of elements one reader has not read yet
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiReader is the reader number given by BufferBroadcastJoin
+//	@return	: 	Element count of the buffer for the reader
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferBroadcastGetCount(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader)
+{
+	UINT64	uiPopPtr	= atomic_load_explicit(&psRingBuffer->asCursor[uiReader].uiBufferPopPtr, memory_order_acquire);
+	UINT64	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+
+	if (uiPopPtr == BUFFER_BROADCAST_CURSOR_FREE)
+	{
+		return 0;
+	}
+
+	return (UINT16)(uiPushPtr - uiPopPtr);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the available (free or can be used for pushing) element count of the buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Available element count of the buffer, as limited by the slowest reader
+//	@note	:	Must be called from the producer only
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferBroadcastGetAvailableCount(SRingBufferBroadcast* psRingBuffer)
+{
+	UINT64	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+
+	psRingBuffer->uiCachedGatePtr = BufferBroadcastGate(psRingBuffer, uiPushPtr);
+
+	return (UINT16)(psRingBuffer->uiBufferSize - (uiPushPtr - psRingBuffer->uiCachedGatePtr));
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Find the read cursor of the slowest active reader
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiPushPtr is the current push pointer
+//	@return	: 	The smallest active read cursor, or uiPushPtr if no reader has joined
+//	@note	:	The fence pairs with the one in BufferBroadcastJoin, so either the producer sees the
+//				new cursor or the joining reader sees the push pointer the gate is based on
+// ---------------------------------------------------------------------------------------------------
+static UINT64 BufferBroadcastGate(SRingBufferBroadcast* psRingBuffer, UINT64 uiPushPtr)
+{
+	UINT64	uiGatePtr	= uiPushPtr;
+	UINT64	uiPopPtr	= 0;
+	UINT16	uiIndex		= 0;
+
+	atomic_thread_fence(memory_order_seq_cst);
+
+	for (uiIndex = 0; uiIndex < RING_BUFFER_BROADCAST_READERS; uiIndex++)
+	{
+		uiPopPtr = atomic_load_explicit(&psRingBuffer->asCursor[uiIndex].uiBufferPopPtr, memory_order_acquire);
+		if ((uiPopPtr != BUFFER_BROADCAST_CURSOR_FREE) && (uiPopPtr < uiGatePtr))
+		{
+			uiGatePtr = uiPopPtr;
+		}
+	}
+
+	return uiGatePtr;
+}
@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferBroadcast.h
+// 	Brief 		: 	Single-producer broadcast ring buffer. Every element is stored once and read by
+//					every consumer through its own read cursor. The producer is held back only by the
+//					slowest active cursor, and consumers can join and leave at any time
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Align with BUFFER_ALIGNED instead of _Alignas
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_BROADCAST_H_
+#define _RING_BUFFER_BROADCAST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdatomic.h>
+#include "TypeDef.h"
+#include "RingBufferConfig.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Value of the read cursor of a reader slot nobody has joined
+#define BUFFER_BROADCAST_CURSOR_FREE		((UINT64)~0ULL)
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Read cursor of one consumer, on its own cache line
+typedef struct S_BUFFER_BROADCAST_CURSOR
+{
+	BUFFER_ALIGNED
+	_Atomic UINT64			uiBufferPopPtr;				// The pointer to start reading, or CURSOR_FREE
+	UINT64					uiCachedPushPtr;			// The consumer's copy of the push pointer
+
+} SBufferBroadcastCursor;
+
+// Broadcast ring buffer structure
+typedef struct S_RING_BUFFER_BROADCAST
+{
+	// Read-only after initialization
+	void*					pvBuffer;					// Data buffer
+	UINT16					uiBufferSize;				// Size of buffer or the total of elements
+	UINT16					uiBufferMask;				// uiBufferSize - 1, used to wrap the pointers
+	UINT16					uiElementSize;				// Size of each element of the buffer in byte
+
+	// Owned by the producer
+	BUFFER_ALIGNED
+	_Atomic UINT64			uiBufferPushPtr;			// The pointer to start writing
+	UINT64					uiCachedGatePtr;			// The producer's copy of the slowest read cursor
+
+	// Owned by the consumers, one each
+	SBufferBroadcastCursor	asCursor[RING_BUFFER_BROADCAST_READERS];
+
+} SRingBufferBroadcast;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferBroadcastInit(SRingBufferBroadcast* psRingBuffer,
+									void* pvBuffer,
+									UINT16 uiBufferSize,
+									UINT16 uiElementSize);
+BOOL			BufferBroadcastJoin(SRingBufferBroadcast* psRingBuffer, UINT16* puiReader);
+void			BufferBroadcastLeave(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader);
+
+BOOL 			BufferBroadcastPushStream(SRingBufferBroadcast* psRingBuffer, void* pvStream, UINT16 uiLength);
+BOOL 			BufferBroadcastPush(SRingBufferBroadcast* psRingBuffer, void* pvData);
+UINT16 			BufferBroadcastPopStream(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader, void* pvStream, UINT16 uiLength);
+UINT16			BufferBroadcastPop(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader, void* pvData);
+UINT16			BufferBroadcastGetCount(SRingBufferBroadcast* psRingBuffer, UINT16 uiReader);
+UINT16			BufferBroadcastGetAvailableCount(SRingBufferBroadcast* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_BROADCAST_H_
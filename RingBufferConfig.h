@@ -0,0 +1,174 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferConfig.h
+// 	Brief 		: 	Compile-time configuration of the ring buffer library. Every option can be
+//					overridden from the compiler command line (-D<OPTION>=<VALUE>)
+//	Author 		: 	AnhNH57
+//  Note 		:
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Add BUFFER_ALIGNED, usable from C and C++
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_CONFIG_H_
+#define _RING_BUFFER_CONFIG_H_
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Set to 1 to take the base types and CallbackFunction1I0O from the platform headers pic24h_generic.h
+// and RTOSHelper.h. On Linux they are taken from TypeDef.h and RingBuffer.h instead, so that the 
+// library builds on its own
+#ifndef RING_BUFFER_PLATFORM_HEADERS
+	#if defined(__linux__)
+		#define RING_BUFFER_PLATFORM_HEADERS	0
+	#else
+		#define RING_BUFFER_PLATFORM_HEADERS	1
+	#endif
+#endif
+
+// Size in byte of a cache line of the target processor. Data owned by different threads is placed on
+// different cache lines to avoid false sharing
+#ifndef RING_BUFFER_CACHE_LINE_SIZE
+	#define RING_BUFFER_CACHE_LINE_SIZE		64
+#endif
+
+// Align a data storage or a structure member to the cache line, e.g. 
+// static UCHAR s_aucStorage[1024] BUFFER_ALIGNED; The copy kernels and the streaming stores run 
+// fastest on aligned storage, but they handle any alignment, so it is advisory only. The public 
+// headers use it instead of _Alignas, which C++ rejects
+#ifndef BUFFER_ALIGNED
+	#define BUFFER_ALIGNED					__attribute__((aligned(RING_BUFFER_CACHE_LINE_SIZE)))
+#endif
+
+// Width in bit of the element indices and element counts of SRingBuffer: 16, 32 or 64. 16 keeps the 
+// original layout, 32 or 64 are needed for buffers with more than 65535 elements
+#ifndef RING_BUFFER_INDEX_BITS
+	#define RING_BUFFER_INDEX_BITS			16
+#endif
+
+// Set to 1 if every SRingBuffer has a power-of-two size. The masked indexing is then selected at 
+// compile time and the push/pop paths have no wrap branch at all. Otherwise it is selected at run 
+// time by BufferInit for each buffer whose size is a power of two
+#ifndef RING_BUFFER_POWER_OF_TWO
+	#define RING_BUFFER_POWER_OF_TWO		0
+#endif
+
+// Set to 1 to build the built-in locks of RingBufferLock.h (Linux only), selected per buffer by 
+// BufferInitWithLock. The call-back functions of BufferInit keep working. On by default when the 
+// platform headers are not used
+#ifndef RING_BUFFER_ENABLE_LOCKS
+	#if (RING_BUFFER_PLATFORM_HEADERS == 0)
+		#define RING_BUFFER_ENABLE_LOCKS	1
+	#else
+		#define RING_BUFFER_ENABLE_LOCKS	0
+	#endif
+#endif
+
+// Number of checks a built-in lock spins for before the waiter yields (ticket spinlock) or parks on the
+// futex (adaptive lock)
+#ifndef RING_BUFFER_LOCK_SPIN_COUNT
+	#define RING_BUFFER_LOCK_SPIN_COUNT		100
+#endif
+
+// Set to 1 to build the blocking and timed operations of RingBufferWait.h (Linux only). It adds the 
+// futex words to SRingBuffer and a waiter check to every operation
+#ifndef RING_BUFFER_ENABLE_WAIT
+	#define RING_BUFFER_ENABLE_WAIT			0
+#endif
+
+// Number of checks a blocked caller spins for before it parks on the futex
+#ifndef RING_BUFFER_WAIT_SPIN_COUNT
+	#define RING_BUFFER_WAIT_SPIN_COUNT		100
+#endif
+
+// Set to 1 to build the eventfd readiness notification of RingBufferEvent.h (Linux only). It adds the
+// event descriptors to SRingBuffer and an armed-flag check to every operation
+#ifndef RING_BUFFER_ENABLE_EVENT
+	#define RING_BUFFER_ENABLE_EVENT		0
+#endif
+
+// Alignment in byte of the messages of RingBufferFrame.h: a power of two, at least the size of
+// BUFFER_INDEX. Every length header and payload starts at a multiple of it inside the data buffer
+#ifndef RING_BUFFER_FRAME_ALIGN
+	#define RING_BUFFER_FRAME_ALIGN			8
+#endif
+
+// Maximum number of readers which can join a broadcast ring buffer of RingBufferBroadcast.h at once
+#ifndef RING_BUFFER_BROADCAST_READERS
+	#define RING_BUFFER_BROADCAST_READERS	8
+#endif
+
+// Maximum number of segment files in the overflow tier of RingBufferSpill.h
+#ifndef RING_BUFFER_SPILL_SEGMENTS
+	#define RING_BUFFER_SPILL_SEGMENTS		16
+#endif
+
+// Maximum number of shards of a sharded ring buffer of RingBufferShard.h
+#ifndef RING_BUFFER_SHARD_MAX
+	#define RING_BUFFER_SHARD_MAX			64
+#endif
+
+// Maximum number of lanes of a prioritized ring buffer of RingBufferPriority.h
+#ifndef RING_BUFFER_PRIORITY_LANES
+	#define RING_BUFFER_PRIORITY_LANES		8
+#endif
+
+// Number of consecutive pops at a quarter of the size or less after which a growable ring buffer of
+// RingBufferGrow.h shrinks to half its size
+#ifndef RING_BUFFER_GROW_SHRINK_POPS
+	#define RING_BUFFER_GROW_SHRINK_POPS	65536
+#endif
+
+// Size-dispatched copy kernels for the data copies of SRingBuffer (RingBufferCopy.h): 1 to enable
+#ifndef RING_BUFFER_ENABLE_COPY_KERNELS
+	#define RING_BUFFER_ENABLE_COPY_KERNELS	0
+#endif
+
+// Transfers of at least this many bytes are copied with non-temporal stores, bypassing the cache.
+// Keep it above the last-level cache share of one core, smaller transfers are better left cached
+#ifndef RING_BUFFER_COPY_STREAM_THRESHOLD
+	#define RING_BUFFER_COPY_STREAM_THRESHOLD	(512 * 1024)
+#endif
+
+// Number of read checkpoints each SRingBuffer can hold at once (BufferCheckpointCreate), up to 32.
+// 0 leaves the checkpoint API and its bookkeeping out of the build
+#ifndef RING_BUFFER_CHECKPOINTS
+	#define RING_BUFFER_CHECKPOINTS			0
+#endif
+
+// Set to 1 to build the statistics of RingBufferStats.h (Linux only). It adds the counters to 
+// SRingBuffer and times every wait for the lock of the push and pop paths
+#ifndef RING_BUFFER_ENABLE_STATS
+	#define RING_BUFFER_ENABLE_STATS		0
+#endif
+
+// Number of buckets of the lock-wait histogram. Bucket 0 counts the waits under 1 ns, bucket n the 
+// waits of [2^(n-1), 2^n) ns and the last bucket everything longer
+#ifndef RING_BUFFER_STATS_BUCKETS
+	#define RING_BUFFER_STATS_BUCKETS		32
+#endif
+
+// Sample every Nth element pushed into an SRingBuffer and record the time it stays queued, see 
+// RingBufferTrace.h (Linux only). 0 leaves the tracing out of the build
+#ifndef RING_BUFFER_TRACE_INTERVAL
+	#define RING_BUFFER_TRACE_INTERVAL		0
+#endif
+
+// Number of sampled elements which can be queued at once. A sample is dropped if they are all in use
+#ifndef RING_BUFFER_TRACE_SLOTS
+	#define RING_BUFFER_TRACE_SLOTS			64
+#endif
+
+// Precision of the residency histogram: each power of two is split into 2^SUB_BITS buckets, and the 
+// histogram covers residencies up to 2^MAX_BITS ns
+#ifndef RING_BUFFER_TRACE_SUB_BITS
+	#define RING_BUFFER_TRACE_SUB_BITS		3
+#endif
+#ifndef RING_BUFFER_TRACE_MAX_BITS
+	#define RING_BUFFER_TRACE_MAX_BITS		40
+#endif
+
+#endif	// _RING_BUFFER_CONFIG_H_
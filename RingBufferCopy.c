@@ -0,0 +1,313 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferCopy.c
+// 	Brief 		: 	Copy kernels of the ring buffer, dispatched by size: fixed inline copies for the small
+//					element sizes, AVX2/SSE2 wide copies for the medium transfers and non-temporal
+//					streaming stores above RING_BUFFER_COPY_STREAM_THRESHOLD, so that a large transfer
+//					does not evict the working set of the other side from the cache
+//	Author 		: 	AnhNH57
+//  Note 		: 	The kernels are selected from the CPU features when the library is loaded (x86 only,
+//					other processors use memcpy). They accept any alignment, aligned storage is only
+//					faster. Requires RING_BUFFER_ENABLE_COPY_KERNELS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Select the kernels at load time, atomic kernel pointers
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdint.h>
+#include "RingBufferCopy.h"
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+#endif
+
+#if (RING_BUFFER_ENABLE_COPY_KERNELS != 1)
+	#error "RingBufferCopy.c requires RING_BUFFER_ENABLE_COPY_KERNELS to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Bytes from an address up to the next multiple of uiAlign
+#define COPY_MISALIGNMENT(pv, uiAlign)		((size_t)(-(uintptr_t)(pv) & ((uiAlign) - 1)))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static void		BufferCopyResolve(void) __attribute__((constructor));
+static void		BufferCopyResolveWide(void* pvDestination, const void* pvSource, size_t szBytes);
+static void		BufferCopyResolveStream(void* pvDestination, const void* pvSource, size_t szBytes);
+static void		BufferCopyMemcpy(void* pvDestination, const void* pvSource, size_t szBytes);
+#if defined(__x86_64__) || defined(__i386__)
+static void		BufferCopyWideSSE2(void* pvDestination, const void* pvSource, size_t szBytes);
+static void		BufferCopyWideAVX2(void* pvDestination, const void* pvSource, size_t szBytes);
+static void		BufferCopyStreamSSE2(void* pvDestination, const void* pvSource, size_t szBytes);
+static void		BufferCopyStreamAVX2(void* pvDestination, const void* pvSource, size_t szBytes);
+#endif
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+// Selected when the library is loaded. A copy made earlier, from another constructor, selects them
+// at its first call
+BufferCopyFunction	g_pfnBufferCopyWide		= BufferCopyResolveWide;
+BufferCopyFunction	g_pfnBufferCopyStream	= BufferCopyResolveStream;
+
+// Name of the selected kernels
+static const char*	s_pcBufferCopyKernel	= "memcpy";
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the name of the kernels selected for the CPU
+//
+//	@param	: 	None
+//	@return	: 	"avx2", "sse2" or "memcpy"
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+const char* BufferCopyGetKernel(void)
+{
+	BufferCopyResolve();
+
+	return __atomic_load_n(&s_pcBufferCopyKernel, __ATOMIC_RELAXED);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Select the kernels from the CPU features
+//
+//	@param	: 	None
+//	@return	: 	Void
+//	@note	:	Runs as a constructor. Every thread selects the same kernels and every shared variable
+//				is written atomically, so concurrent calls are harmless
+// ---------------------------------------------------------------------------------------------------
+static void BufferCopyResolve(void)
+{
+	BufferCopyFunction	pfnWide		= BufferCopyMemcpy;
+	BufferCopyFunction	pfnStream	= BufferCopyMemcpy;
+	const char*			pcKernel	= "memcpy";
+
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	{
+		pfnWide		= BufferCopyWideAVX2;
+		pfnStream	= BufferCopyStreamAVX2;
+		pcKernel	= "avx2";
+	}
+	else if (__builtin_cpu_supports("sse2"))
+	{
+		pfnWide		= BufferCopyWideSSE2;
+		pfnStream	= BufferCopyStreamSSE2;
+		pcKernel	= "sse2";
+	}
+#endif
+
+	__atomic_store_n(&s_pcBufferCopyKernel, pcKernel, __ATOMIC_RELAXED);
+	__atomic_store_n(&g_pfnBufferCopyWide, pfnWide, __ATOMIC_RELAXED);
+	__atomic_store_n(&g_pfnBufferCopyStream, pfnStream, __ATOMIC_RELAXED);
+}
+
+static void BufferCopyResolveWide(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	BufferCopyResolve();
+	__atomic_load_n(&g_pfnBufferCopyWide, __ATOMIC_RELAXED)(pvDestination, pvSource, szBytes);
+}
+
+static void BufferCopyResolveStream(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	BufferCopyResolve();
+	__atomic_load_n(&g_pfnBufferCopyStream, __ATOMIC_RELAXED)(pvDestination, pvSource, szBytes);
+}
+
+static void BufferCopyMemcpy(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	memcpy(pvDestination, pvSource, szBytes);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy a medium transfer with 16-byte vectors
+//
+//	@param	: 	pvDestination is the destination
+//	@param	: 	pvSource is the source, not overlapping the destination
+//	@param	: 	szBytes is the number of bytes to be copied
+//	@return	: 	Void
+//	@note	:	The tail is copied by one vector overlapping the last full one, without a byte loop
+// ---------------------------------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static void BufferCopyWideSSE2(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	UCHAR*			pucDestination	= (UCHAR*)pvDestination;
+	const UCHAR*	pucSource		= (const UCHAR*)pvSource;
+	__m128i			sA, sB, sC, sD;
+
+	if (szBytes < 16)
+	{
+		memcpy(pvDestination, pvSource, szBytes);
+		return;
+	}
+
+	while (szBytes >= 64)
+	{
+		sA = _mm_loadu_si128((const __m128i*)(pucSource));
+		sB = _mm_loadu_si128((const __m128i*)(pucSource + 16));
+		sC = _mm_loadu_si128((const __m128i*)(pucSource + 32));
+		sD = _mm_loadu_si128((const __m128i*)(pucSource + 48));
+		_mm_storeu_si128((__m128i*)(pucDestination), sA);
+		_mm_storeu_si128((__m128i*)(pucDestination + 16), sB);
+		_mm_storeu_si128((__m128i*)(pucDestination + 32), sC);
+		_mm_storeu_si128((__m128i*)(pucDestination + 48), sD);
+		pucSource		+= 64;
+		pucDestination	+= 64;
+		szBytes			-= 64;
+	}
+
+	while (szBytes >= 16)
+	{
+		_mm_storeu_si128((__m128i*)pucDestination, _mm_loadu_si128((const __m128i*)pucSource));
+		pucSource		+= 16;
+		pucDestination	+= 16;
+		szBytes			-= 16;
+	}
+
+	if (szBytes > 0)
+	{
+		pucSource		-= 16 - szBytes;
+		pucDestination	-= 16 - szBytes;
+		_mm_storeu_si128((__m128i*)pucDestination, _mm_loadu_si128((const __m128i*)pucSource));
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy a medium transfer with 32-byte vectors
+//
+//	@param	: 	pvDestination is the destination
+//	@param	: 	pvSource is the source, not overlapping the destination
+//	@param	: 	szBytes is the number of bytes to be copied
+//	@return	: 	Void
+//	@note	:	The tail is copied by one vector overlapping the last full one, without a byte loop
+// ---------------------------------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void BufferCopyWideAVX2(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	UCHAR*			pucDestination	= (UCHAR*)pvDestination;
+	const UCHAR*	pucSource		= (const UCHAR*)pvSource;
+	__m256i			sA, sB, sC, sD;
+
+	if (szBytes < 32)
+	{
+		memcpy(pvDestination, pvSource, szBytes);
+		return;
+	}
+
+	while (szBytes >= 128)
+	{
+		sA = _mm256_loadu_si256((const __m256i*)(pucSource));
+		sB = _mm256_loadu_si256((const __m256i*)(pucSource + 32));
+		sC = _mm256_loadu_si256((const __m256i*)(pucSource + 64));
+		sD = _mm256_loadu_si256((const __m256i*)(pucSource + 96));
+		_mm256_storeu_si256((__m256i*)(pucDestination), sA);
+		_mm256_storeu_si256((__m256i*)(pucDestination + 32), sB);
+		_mm256_storeu_si256((__m256i*)(pucDestination + 64), sC);
+		_mm256_storeu_si256((__m256i*)(pucDestination + 96), sD);
+		pucSource		+= 128;
+		pucDestination	+= 128;
+		szBytes			-= 128;
+	}
+
+	while (szBytes >= 32)
+	{
+		_mm256_storeu_si256((__m256i*)pucDestination, _mm256_loadu_si256((const __m256i*)pucSource));
+		pucSource		+= 32;
+		pucDestination	+= 32;
+		szBytes			-= 32;
+	}
+
+	if (szBytes > 0)
+	{
+		pucSource		-= 32 - szBytes;
+		pucDestination	-= 32 - szBytes;
+		_mm256_storeu_si256((__m256i*)pucDestination, _mm256_loadu_si256((const __m256i*)pucSource));
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy a large transfer with 16-byte non-temporal stores, bypassing the cache
+//
+//	@param	: 	pvDestination is the destination
+//	@param	: 	pvSource is the source, not overlapping the destination
+//	@param	: 	szBytes is the number of bytes to be copied, at least RING_BUFFER_COPY_STREAM_THRESHOLD
+//	@return	: 	Void
+//	@note	:	The head is copied normally up to the first aligned destination address, and the
+//				streaming stores are fenced before returning so that the data is visible to the
+//				other side once the pointers are published
+// ---------------------------------------------------------------------------------------------------
+__attribute__((target("sse2")))
+static void BufferCopyStreamSSE2(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	UCHAR*			pucDestination	= (UCHAR*)pvDestination;
+	const UCHAR*	pucSource		= (const UCHAR*)pvSource;
+	size_t			szHead			= COPY_MISALIGNMENT(pucDestination, 16);
+
+	memcpy(pucDestination, pucSource, szHead);
+	pucSource		+= szHead;
+	pucDestination	+= szHead;
+	szBytes			-= szHead;
+
+	while (szBytes >= 64)
+	{
+		_mm_stream_si128((__m128i*)(pucDestination),		_mm_loadu_si128((const __m128i*)(pucSource)));
+		_mm_stream_si128((__m128i*)(pucDestination + 16),	_mm_loadu_si128((const __m128i*)(pucSource + 16)));
+		_mm_stream_si128((__m128i*)(pucDestination + 32),	_mm_loadu_si128((const __m128i*)(pucSource + 32)));
+		_mm_stream_si128((__m128i*)(pucDestination + 48),	_mm_loadu_si128((const __m128i*)(pucSource + 48)));
+		pucSource		+= 64;
+		pucDestination	+= 64;
+		szBytes			-= 64;
+	}
+
+	_mm_sfence();
+
+	BufferCopyWideSSE2(pucDestination, pucSource, szBytes);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy a large transfer with 32-byte non-temporal stores, bypassing the cache
+//
+//	@param	: 	pvDestination is the destination
+//	@param	: 	pvSource is the source, not overlapping the destination
+//	@param	: 	szBytes is the number of bytes to be copied, at least RING_BUFFER_COPY_STREAM_THRESHOLD
+//	@return	: 	Void
+//	@note	:	See BufferCopyStreamSSE2
+// ---------------------------------------------------------------------------------------------------
+__attribute__((target("avx2")))
+static void BufferCopyStreamAVX2(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	UCHAR*			pucDestination	= (UCHAR*)pvDestination;
+	const UCHAR*	pucSource		= (const UCHAR*)pvSource;
+	size_t			szHead			= COPY_MISALIGNMENT(pucDestination, 32);
+
+	memcpy(pucDestination, pucSource, szHead);
+	pucSource		+= szHead;
+	pucDestination	+= szHead;
+	szBytes			-= szHead;
+
+	while (szBytes >= 128)
+	{
+		_mm256_stream_si256((__m256i*)(pucDestination),		_mm256_loadu_si256((const __m256i*)(pucSource)));
+		_mm256_stream_si256((__m256i*)(pucDestination + 32),	_mm256_loadu_si256((const __m256i*)(pucSource + 32)));
+		_mm256_stream_si256((__m256i*)(pucDestination + 64),	_mm256_loadu_si256((const __m256i*)(pucSource + 64)));
+		_mm256_stream_si256((__m256i*)(pucDestination + 96),	_mm256_loadu_si256((const __m256i*)(pucSource + 96)));
+		pucSource		+= 128;
+		pucDestination	+= 128;
+		szBytes			-= 128;
+	}
+
+	_mm_sfence();
+
+	BufferCopyWideAVX2(pucDestination, pucSource, szBytes);
+}
+
+#endif
@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferCopy.h
+// 	Brief 		: 	Copy kernels of the ring buffer, dispatched by size: fixed inline copies for the small
+//					element sizes, AVX2/SSE2 wide copies for the medium transfers and non-temporal
+//					streaming stores above RING_BUFFER_COPY_STREAM_THRESHOLD, so that a large transfer
+//					does not evict the working set of the other side from the cache
+//	Author 		: 	AnhNH57
+//  Note 		: 	The kernels are selected from the CPU features when the library is loaded (x86 only,
+//					other processors use memcpy). They accept any alignment, aligned storage is only
+//					faster. Requires RING_BUFFER_ENABLE_COPY_KERNELS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Select the kernels at load time, atomic kernel pointers
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_COPY_H_
+#define _RING_BUFFER_COPY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stddef.h>
+#include <string.h>
+#include "TypeDef.h"
+#include "RingBufferConfig.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Copy kernel
+typedef void (*BufferCopyFunction)(void* pvDestination, const void* pvSource, size_t szBytes);
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+const char*		BufferCopyGetKernel(void);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+// Kernels selected for the CPU, read and written atomically
+extern BufferCopyFunction	g_pfnBufferCopyWide;
+extern BufferCopyFunction	g_pfnBufferCopyStream;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy data between a ring buffer and the caller
+//
+//	@param	: 	pvDestination is the destination
+//	@param	: 	pvSource is the source, not overlapping the destination
+//	@param	: 	szBytes is the number of bytes to be copied
+//	@return	: 	Void
+//	@note	:	The element sizes up to 16 bytes are copied inline without a call
+// ---------------------------------------------------------------------------------------------------
+static inline void BufferCopy(void* pvDestination, const void* pvSource, size_t szBytes)
+{
+	switch (szBytes)
+	{
+		case 0:		return;
+		case 1:		memcpy(pvDestination, pvSource, 1);		return;
+		case 2:		memcpy(pvDestination, pvSource, 2);		return;
+		case 4:		memcpy(pvDestination, pvSource, 4);		return;
+		case 8:		memcpy(pvDestination, pvSource, 8);		return;
+		case 16:	memcpy(pvDestination, pvSource, 16);	return;
+		default:	break;
+	}
+
+	if (szBytes < RING_BUFFER_COPY_STREAM_THRESHOLD)
+	{
+		__atomic_load_n(&g_pfnBufferCopyWide, __ATOMIC_RELAXED)(pvDestination, pvSource, szBytes);
+	}
+	else
+	{
+		__atomic_load_n(&g_pfnBufferCopyStream, __ATOMIC_RELAXED)(pvDestination, pvSource, szBytes);
+	}
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_COPY_H_
@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferEvent.c
+// 	Brief 		: 	Readiness notification of the ring buffer through eventfd, so that a ring buffer can
+//					sit in an epoll set next to sockets and timers. The pop event is raised when data
+//					arrives for a waiting consumer, the push event when room is freed for a waiting
+//					producer. Raising is coalesced: at most one write(2) per acknowledgement
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_EVENT to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include "RingBufferEvent.h"
+
+#if (RING_BUFFER_ENABLE_EVENT != 1)
+	#error "RingBufferEvent.c requires RING_BUFFER_ENABLE_EVENT to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Create the readiness events of a ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer, already initialized by BufferInit
+//	@return	: 	TRUE if creating successfully and vice versa
+//	@note	:	The pop event starts armed (the consumer waits for data), the push event starts
+//				disarmed until a producer finds the buffer full and calls BufferEventAckPush
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferEventInit(SRingBuffer* psRingBuffer)
+{
+	psRingBuffer->iPopEventFd	= eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	psRingBuffer->iPushEventFd	= eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+	if ((psRingBuffer->iPopEventFd < 0) || (psRingBuffer->iPushEventFd < 0))
+	{
+		BufferEventDeinit(psRingBuffer);
+		return FALSE;
+	}
+
+	__atomic_store_n(&psRingBuffer->iPushEventArmed, 0, __ATOMIC_SEQ_CST);
+	BufferEventAckPop(psRingBuffer);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Close the readiness events of a ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+void BufferEventDeinit(SRingBuffer* psRingBuffer)
+{
+	__atomic_store_n(&psRingBuffer->iPopEventArmed, 0, __ATOMIC_SEQ_CST);
+	__atomic_store_n(&psRingBuffer->iPushEventArmed, 0, __ATOMIC_SEQ_CST);
+
+	if (psRingBuffer->iPopEventFd >= 0)
+	{
+		close(psRingBuffer->iPopEventFd);
+		psRingBuffer->iPopEventFd = -1;
+	}
+
+	if (psRingBuffer->iPushEventFd >= 0)
+	{
+		close(psRingBuffer->iPushEventFd);
+		psRingBuffer->iPushEventFd = -1;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the descriptor which becomes readable when data can be popped
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	The eventfd descriptor, to be added to an epoll set with EPOLLIN
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+int BufferEventGetPopFd(SRingBuffer* psRingBuffer)
+{
+	return psRingBuffer->iPopEventFd;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the descriptor which becomes readable when room is freed for pushing
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	The eventfd descriptor, to be added to an epoll set with EPOLLIN
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+int BufferEventGetPushFd(SRingBuffer* psRingBuffer)
+{
+	return psRingBuffer->iPushEventFd;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Acknowledge the pop event and re-arm it. The consumer calls it when the pop descriptor
+//				is readable, then pops until the buffer is empty
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	If data is already waiting the event is raised again at once, so it cannot be lost
+// ---------------------------------------------------------------------------------------------------
+void BufferEventAckPop(SRingBuffer* psRingBuffer)
+{
+	uint64_t	ulValue	= 0;
+
+	// Clear the descriptor, then re-arm and re-check the buffer
+	if (read(psRingBuffer->iPopEventFd, &ulValue, sizeof(ulValue)) < 0)
+	{
+		// Nothing to clear
+	}
+
+	__atomic_store_n(&psRingBuffer->iPopEventArmed, 1, __ATOMIC_SEQ_CST);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	if (BufferIsPopEnable(psRingBuffer) == TRUE)
+	{
+		BUFFER_RAISE_POP_EVENT(psRingBuffer);
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Acknowledge the push event and re-arm it. The producer calls it when pushing fails
+//				because the buffer is full, and when the push descriptor is readable
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	If room is already free the event is raised again at once, so it cannot be lost
+// ---------------------------------------------------------------------------------------------------
+void BufferEventAckPush(SRingBuffer* psRingBuffer)
+{
+	uint64_t	ulValue	= 0;
+
+	// Clear the descriptor, then re-arm and re-check the buffer
+	if (read(psRingBuffer->iPushEventFd, &ulValue, sizeof(ulValue)) < 0)
+	{
+		// Nothing to clear
+	}
+
+	__atomic_store_n(&psRingBuffer->iPushEventArmed, 1, __ATOMIC_SEQ_CST);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	if (BufferIsPushEnable(psRingBuffer) == TRUE)
+	{
+		BUFFER_RAISE_PUSH_EVENT(psRingBuffer);
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Make an event descriptor readable
+//
+//	@param	: 	iEventFd is the eventfd descriptor
+//	@return	: 	Void
+//	@note	:	Called through BUFFER_RAISE_POP_EVENT/BUFFER_RAISE_PUSH_EVENT only when the event is
+//				armed, so a burst of operations costs at most one write(2)
+// ---------------------------------------------------------------------------------------------------
+void BufferEventRaise(int iEventFd)
+{
+	uint64_t	ulValue	= 1;
+
+	if (write(iEventFd, &ulValue, sizeof(ulValue)) < 0)
+	{
+		// The counter can only overflow if nobody reads it, the descriptor stays readable anyway
+	}
+}
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferEvent.h
+// 	Brief 		: 	Readiness notification of the ring buffer through eventfd, so that a ring buffer can
+//					sit in an epoll set next to sockets and timers. The pop event is raised when data
+//					arrives for a waiting consumer, the push event when room is freed for a waiting
+//					producer. Raising is coalesced: at most one write(2) per acknowledgement
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_EVENT to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_EVENT_H_
+#define _RING_BUFFER_EVENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Raise the pop (resp. push) event if its side has acknowledged the previous one. The fence pairs with
+// the one taken by the acknowledgement between re-arming and re-checking the buffer
+#define BUFFER_RAISE_POP_EVENT(ps)																	\
+			do																						\
+			{																						\
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);											\
+				if ((__atomic_load_n(&(ps)->iPopEventArmed, __ATOMIC_RELAXED) != 0) &&				\
+					(__atomic_exchange_n(&(ps)->iPopEventArmed, 0, __ATOMIC_ACQ_REL) != 0))			\
+				{																					\
+					BufferEventRaise((ps)->iPopEventFd);											\
+				}																					\
+			} while (0)
+
+#define BUFFER_RAISE_PUSH_EVENT(ps)																	\
+			do																						\
+			{																						\
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);											\
+				if ((__atomic_load_n(&(ps)->iPushEventArmed, __ATOMIC_RELAXED) != 0) &&				\
+					(__atomic_exchange_n(&(ps)->iPushEventArmed, 0, __ATOMIC_ACQ_REL) != 0))		\
+				{																					\
+					BufferEventRaise((ps)->iPushEventFd);											\
+				}																					\
+			} while (0)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferEventInit(SRingBuffer* psRingBuffer);
+void			BufferEventDeinit(SRingBuffer* psRingBuffer);
+int				BufferEventGetPopFd(SRingBuffer* psRingBuffer);
+int				BufferEventGetPushFd(SRingBuffer* psRingBuffer);
+void			BufferEventAckPop(SRingBuffer* psRingBuffer);
+void			BufferEventAckPush(SRingBuffer* psRingBuffer);
+
+void			BufferEventRaise(int iEventFd);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_EVENT_H_
@@ -0,0 +1,159 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferFd.c
+// 	Brief 		: 	File descriptor I/O of a byte ring buffer. The data is read from a file descriptor
+//					straight into the free region of the data buffer, and written from the occupied
+//					region straight to a file descriptor, with one readv/writev over its one or two
+//					contiguous spans and no intermediate copy
+//	Author 		: 	AnhNH57
+//  Note 		: 	POSIX only. The ring buffer must hold bytes (uiElementSize 1)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Document the non-blocking descriptor needed by BufferFillFromFd
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <errno.h>
+#include <sys/uio.h>
+#include "RingBufferFd.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static int		BufferFdSpans(SBufferSpan asSpan[BUFFER_SPAN_COUNT], size_t szMaxBytes, struct iovec asIovec[BUFFER_SPAN_COUNT]);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Read from a file descriptor into the free region of the buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer, of bytes
+//	@param	: 	iFd is the file descriptor: a pipe, a socket, a file... Non-blocking (O_NONBLOCK)
+//	@param	:	szMaxBytes is the maximum number of bytes to be read
+//	@return	: 	The number of bytes read and pushed, 0 at the end of file, -1 on error with errno set:
+//				ENOBUFS if the buffer is full, EBUSY if another reservation is outstanding, EINVAL if
+//				the elements are not bytes, or the error of readv (EAGAIN if nothing can be read)
+//	@note	:	One readv over the reserved region (BufferReserve), committed with the bytes read.
+//				The reservation is held across the readv and refuses every other push meanwhile, so 
+//				a blocking descriptor would stall the other producers until data arrives. Use a 
+//				non-blocking one, or call it only once poll/epoll reports the descriptor readable
+// ---------------------------------------------------------------------------------------------------
+ssize_t BufferFillFromFd(SRingBuffer* psRingBuffer, int iFd, size_t szMaxBytes)
+{
+	SBufferSpan		asSpan[BUFFER_SPAN_COUNT];
+	struct iovec	asIovec[BUFFER_SPAN_COUNT];
+	BUFFER_INDEX	uiLength	= BufferGetAvailableCount(psRingBuffer);
+	ssize_t			iResult		= 0;
+
+	if (psRingBuffer->uiElementSize != 1)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (szMaxBytes < uiLength)
+	{
+		uiLength = (BUFFER_INDEX)szMaxBytes;
+	}
+
+	if (uiLength == 0)
+	{
+		errno = ENOBUFS;
+		return -1;
+	}
+
+	if (BufferReserve(psRingBuffer, uiLength, asSpan) == FALSE)
+	{
+		errno = EBUSY;
+		return -1;
+	}
+
+	do
+	{
+		iResult = readv(iFd, asIovec, BufferFdSpans(asSpan, uiLength, asIovec));
+	} while ((iResult < 0) && (errno == EINTR));
+
+	// Commit what was read, nothing on an error or at the end of file
+	BufferCommit(psRingBuffer, (iResult > 0) ? (BUFFER_INDEX)iResult : 0);
+
+	return iResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Write the occupied region of the buffer to a file descriptor
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer, of bytes
+//	@param	: 	iFd is the file descriptor: a pipe, a socket, a file...
+//	@param	:	szMaxBytes is the maximum number of bytes to be written
+//	@return	: 	The number of bytes written and popped, 0 if the buffer is empty, -1 on error with
+//				errno set: EINVAL if the elements are not bytes, or the error of writev
+//	@note	:	One writev over the peeked region (BufferPeek), released with the bytes written. Only
+//				one consumer may drain the buffer at a time.
+//				vmsplice is not used for pipes: the pipe would keep referring to the pages of the data
+//				buffer after BufferConsume, and the producer would overwrite the data still queued in it
+// ---------------------------------------------------------------------------------------------------
+ssize_t BufferDrainToFd(SRingBuffer* psRingBuffer, int iFd, size_t szMaxBytes)
+{
+	SBufferSpan		asSpan[BUFFER_SPAN_COUNT];
+	struct iovec	asIovec[BUFFER_SPAN_COUNT];
+	ssize_t			iResult		= 0;
+
+	if (psRingBuffer->uiElementSize != 1)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((BufferPeek(psRingBuffer, asSpan) == 0) || (szMaxBytes == 0))
+	{
+		return 0;
+	}
+
+	do
+	{
+		iResult = writev(iFd, asIovec, BufferFdSpans(asSpan, szMaxBytes, asIovec));
+	} while ((iResult < 0) && (errno == EINTR));
+
+	if (iResult > 0)
+	{
+		BufferConsume(psRingBuffer, (BUFFER_INDEX)iResult);
+	}
+
+	return iResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Describe the spans of a region as an I/O vector
+//
+//	@param	: 	asSpan is the region, of bytes
+//	@param	:	szMaxBytes is the maximum number of bytes of the vector
+//	@param	:	asIovec receives the vector
+//	@return	: 	Number of entries of the vector, 1 or 2
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static int BufferFdSpans(SBufferSpan asSpan[BUFFER_SPAN_COUNT], size_t szMaxBytes, struct iovec asIovec[BUFFER_SPAN_COUNT])
+{
+	asIovec[0].iov_base	= asSpan[0].pvData;
+	asIovec[0].iov_len	= (asSpan[0].uiLength < szMaxBytes) ? asSpan[0].uiLength : szMaxBytes;
+	szMaxBytes			-= asIovec[0].iov_len;
+
+	if ((asSpan[1].uiLength == 0) || (szMaxBytes == 0))
+	{
+		return 1;
+	}
+
+	asIovec[1].iov_base	= asSpan[1].pvData;
+	asIovec[1].iov_len	= (asSpan[1].uiLength < szMaxBytes) ? asSpan[1].uiLength : szMaxBytes;
+
+	return 2;
+}
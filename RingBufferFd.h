@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferFd.h
+// 	Brief 		: 	File descriptor I/O of a byte ring buffer. The data is read from a file descriptor
+//					straight into the free region of the data buffer, and written from the occupied
+//					region straight to a file descriptor, with one readv/writev over its one or two
+//					contiguous spans and no intermediate copy
+//	Author 		: 	AnhNH57
+//  Note 		: 	POSIX only. The ring buffer must hold bytes (uiElementSize 1). The descriptor read by
+//					BufferFillFromFd must be non-blocking (see Examples/RingBufferFdRelay.c)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Document the non-blocking descriptor needed by BufferFillFromFd
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_FD_H_
+#define _RING_BUFFER_FD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <sys/types.h>
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+ssize_t			BufferFillFromFd(SRingBuffer* psRingBuffer, int iFd, size_t szMaxBytes);
+ssize_t			BufferDrainToFd(SRingBuffer* psRingBuffer, int iFd, size_t szMaxBytes);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_FD_H_
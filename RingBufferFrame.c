@@ -0,0 +1,263 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferFrame.c
+// 	Brief 		: 	Framed variable-length messages over a byte ring buffer. Each message is stored as
+//					a length header followed by the payload. When a message would straddle the end of
+//					the data buffer, a padding marker fills the tail and the message starts over at the
+//					beginning, so every message is contiguous
+//	Author 		: 	AnhNH57
+//  Note 		: 	The ring buffer must have 1-byte elements
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Rewind an empty buffer instead of padding its tail
+// 	1.02  	AnhNH57  	17-10-2026 	Pop and consume a whole message under one lock
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "RingBufferFrame.h"
+
+#if ((RING_BUFFER_FRAME_ALIGN & (RING_BUFFER_FRAME_ALIGN - 1)) != 0)
+	#error "RING_BUFFER_FRAME_ALIGN must be a power of two"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Parameter of BufferFrameParse
+typedef struct S_BUFFER_FRAME_PARSE
+{
+	void*					pvMessage;					// Storage the message is copied to, NULL for none
+	BUFFER_INDEX			uiMaxLength;				// Size in byte of pvMessage
+	BOOL					bConsume;					// Release the message too, not only the padding ahead
+	void*					pvFrame;					// Receives the address of the message in the buffer
+	BUFFER_INDEX			uiLength;					// Receives the length of the message, 0 if none
+
+} SBufferFrameParse;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static BUFFER_INDEX	BufferFrameParse(SBufferSpan asSpan[BUFFER_SPAN_COUNT], void* pvParam);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a ring buffer of framed messages
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvBuffer is the data storage area, aligned to RING_BUFFER_FRAME_ALIGN
+//	@param	:	uiBufferSize is the size in byte of the data storage area, a multiple of 
+//				RING_BUFFER_FRAME_ALIGN
+//	@param	:	callbackLock is the call-back function for locking multi-access
+//	@param	:	callbackUnlock is the call-back function for unlocking multi-access
+//	@param	:	pvCallbackParam is the parameter of the call-back functions
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	A mirrored buffer from BufferInitMirrored with 1-byte elements can be used as well, its
+//				messages never need padding. BufferFramePop and BufferFrameConsume can be shared by 
+//				several consumers, BufferFramePeek only by one
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferFrameInit(SRingBuffer* psRingBuffer, 
+					 void* pvBuffer, 
+					 BUFFER_INDEX uiBufferSize, 
+					 CallbackFunction1I0O callbackLock, 
+					 CallbackFunction1I0O callbackUnlock, 
+					 void* pvCallbackParam)
+{
+	if ((sizeof(BUFFER_INDEX) > RING_BUFFER_FRAME_ALIGN) ||
+		(uiBufferSize == 0) ||
+		((uiBufferSize % RING_BUFFER_FRAME_ALIGN) != 0) ||
+		(((uintptr_t)pvBuffer % RING_BUFFER_FRAME_ALIGN) != 0))
+	{
+		return FALSE;
+	}
+
+	BufferInit(psRingBuffer, pvBuffer, uiBufferSize, 1, callbackLock, callbackUnlock, pvCallbackParam);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a whole message into the buffer
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	pvMessage is the message to be pushed
+//	@param	:	uiLength is the length in byte of the message, not zero
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	The message is written into a reserved region and committed together with its padding
+//				marker, so a consumer never sees a part of it
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferFramePush(SRingBuffer* psRingBuffer, void* pvMessage, BUFFER_INDEX uiLength)
+{
+	SBufferSpan		asSpan[BUFFER_SPAN_COUNT];
+	BUFFER_INDEX	uiFrameSize		= 0;
+	BUFFER_INDEX	uiReserveSize	= 0;
+	BUFFER_INDEX	uiCommitSize	= 0;
+	BUFFER_INDEX	uiPadding		= BUFFER_FRAME_PADDING;
+	UCHAR*			pucFrame		= NULL;
+
+	if ((uiLength == 0) || (uiLength > psRingBuffer->uiBufferSize - BUFFER_FRAME_HEADER_SIZE))
+	{
+		return FALSE;
+	}
+
+	uiFrameSize		= BUFFER_FRAME_SIZE(uiLength);
+	uiReserveSize	= uiFrameSize;
+
+	while (pucFrame == NULL)
+	{
+		if ((uiReserveSize > psRingBuffer->uiBufferSize) ||
+			(BufferReserve(psRingBuffer, uiReserveSize, asSpan) == FALSE))
+		{
+			return FALSE;
+		}
+
+		if (asSpan[0].uiLength >= uiFrameSize)
+		{
+			// The message fits before the end of the buffer
+			pucFrame		= asSpan[0].pvData;
+			uiCommitSize	= uiFrameSize;
+		}
+		else if (asSpan[1].uiLength >= uiFrameSize)
+		{
+			// Pad the tail of the buffer and start the message over at the beginning
+			memcpy(asSpan[0].pvData, &uiPadding, sizeof(uiPadding));
+			pucFrame		= asSpan[1].pvData;
+			uiCommitSize	= asSpan[0].uiLength + uiFrameSize;
+		}
+		else
+		{
+			// The message would straddle the end. Start over at the beginning if the buffer is empty,
+			// else reserve again with room for the padding too
+			BufferCommit(psRingBuffer, 0);
+			if (BufferRewind(psRingBuffer) == FALSE)
+			{
+				uiReserveSize = asSpan[0].uiLength + uiFrameSize;
+			}
+		}
+	}
+
+	memcpy(pucFrame, &uiLength, sizeof(uiLength));
+	memcpy(pucFrame + BUFFER_FRAME_HEADER_SIZE, pvMessage, uiLength);
+
+	return BufferCommit(psRingBuffer, uiCommitSize);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a whole message out of the buffer
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	pvMessage is the storage for the message popped out
+//	@param	:	uiMaxLength is the size in byte of the storage
+//	@return	: 	The length of the message popped out, 0 if the buffer is empty or the message is longer
+//				than uiMaxLength
+//	@note	:	The padding marker, the message and its release are handled under one lock, so several
+//				consumers can pop. A message too long for the storage stays in the buffer, 
+//				BufferFramePeek tells its length
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferFramePop(SRingBuffer* psRingBuffer, void* pvMessage, BUFFER_INDEX uiMaxLength)
+{
+	SBufferFrameParse	sParse	= { pvMessage, uiMaxLength, TRUE, NULL, 0 };
+
+	BufferPeekConsume(psRingBuffer, BufferFrameParse, &sParse);
+	if (sParse.uiLength > uiMaxLength)
+	{
+		return 0;
+	}
+
+	return sParse.uiLength;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Look at the oldest message in place, without copying it out
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	ppvMessage receives the address of the message inside the data buffer, may be NULL
+//	@return	: 	The length of the message, 0 if the buffer is empty
+//	@note	:	A padding marker ahead of the message is released here. The message stays valid until
+//				BufferFrameConsume is called, so only one consumer can use BufferFramePeek
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferFramePeek(SRingBuffer* psRingBuffer, void** ppvMessage)
+{
+	SBufferFrameParse	sParse	= { NULL, 0, FALSE, NULL, 0 };
+
+	BufferPeekConsume(psRingBuffer, BufferFrameParse, &sParse);
+	if ((ppvMessage) && (sParse.uiLength != 0))
+	{
+		*ppvMessage = sParse.pvFrame;
+	}
+
+	return sParse.uiLength;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the oldest message from the buffer without copying it out
+//		  
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	TRUE if a message was released and vice versa
+//	@note	:	The padding marker and the message are released under one lock
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferFrameConsume(SRingBuffer* psRingBuffer)
+{
+	SBufferFrameParse	sParse	= { NULL, 0, TRUE, NULL, 0 };
+
+	BufferPeekConsume(psRingBuffer, BufferFrameParse, &sParse);
+
+	return (sParse.uiLength != 0) ? TRUE : FALSE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Find the oldest message, copy it out and tell how many bytes to release
+//		  
+//	@param	: 	asSpan is the occupied region of the buffer
+//	@param	:	pvParam is the SBufferFrameParse of the caller
+//	@return	: 	The number of bytes to be released: the padding marker ahead of the message, and the
+//				message itself if bConsume is set and it fits into pvMessage
+//	@note	:	Called by BufferPeekConsume with the buffer locked
+// ---------------------------------------------------------------------------------------------------
+static BUFFER_INDEX BufferFrameParse(SBufferSpan asSpan[BUFFER_SPAN_COUNT], void* pvParam)
+{
+	SBufferFrameParse*	psParse		= (SBufferFrameParse*)pvParam;
+	UCHAR*				pucHeader	= (UCHAR*)asSpan[0].pvData;
+	BUFFER_INDEX		uiSkip		= 0;
+	BUFFER_INDEX		uiLength	= 0;
+
+	// Headers never wrap, the first span always holds a whole one
+	memcpy(&uiLength, pucHeader, sizeof(uiLength));
+	if (uiLength == BUFFER_FRAME_PADDING)
+	{
+		// The padding runs to the end of the buffer, which is where the first span ends. The message
+		// was committed together with it and starts over at the beginning
+		uiSkip = asSpan[0].uiLength;
+		if (asSpan[1].uiLength == 0)
+		{
+			return uiSkip;
+		}
+
+		pucHeader = (UCHAR*)asSpan[1].pvData;
+		memcpy(&uiLength, pucHeader, sizeof(uiLength));
+	}
+
+	psParse->pvFrame	= pucHeader + BUFFER_FRAME_HEADER_SIZE;
+	psParse->uiLength	= uiLength;
+
+	if ((psParse->bConsume == FALSE) || ((psParse->pvMessage) && (uiLength > psParse->uiMaxLength)))
+	{
+		return uiSkip;
+	}
+
+	if (psParse->pvMessage)
+	{
+		memcpy(psParse->pvMessage, psParse->pvFrame, uiLength);
+	}
+
+	return uiSkip + BUFFER_FRAME_SIZE(uiLength);
+}
@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferFrame.h
+// 	Brief 		: 	Framed variable-length messages over a byte ring buffer. Each message is stored as
+//					a length header followed by the payload. When a message would straddle the end of
+//					the data buffer, a padding marker fills the tail and the message starts over at the
+//					beginning, so every message is contiguous
+//	Author 		: 	AnhNH57
+//  Note 		: 	The ring buffer must have 1-byte elements
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_FRAME_H_
+#define _RING_BUFFER_FRAME_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Length header value marking the rest of the data buffer as padding
+#define BUFFER_FRAME_PADDING		((BUFFER_INDEX)~(BUFFER_INDEX)0)
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Round a byte count up to the frame alignment
+#define BUFFER_FRAME_ROUND(uiLength)	\
+			((BUFFER_INDEX)(((uiLength) + (RING_BUFFER_FRAME_ALIGN - 1)) & ~(BUFFER_INDEX)(RING_BUFFER_FRAME_ALIGN - 1)))
+
+// Size in byte of the length header, the payload follows it at the frame alignment
+#define BUFFER_FRAME_HEADER_SIZE		BUFFER_FRAME_ROUND(sizeof(BUFFER_INDEX))
+
+// Bytes taken in the data buffer by a message of uiLength bytes
+#define BUFFER_FRAME_SIZE(uiLength)		(BUFFER_FRAME_HEADER_SIZE + BUFFER_FRAME_ROUND(uiLength))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferFrameInit(SRingBuffer* psRingBuffer, 
+								void* pvBuffer, 
+								BUFFER_INDEX uiBufferSize, 
+								CallbackFunction1I0O callbackLock, 
+								CallbackFunction1I0O callbackUnlock, 
+								void* pvCallbackParam);
+BOOL			BufferFramePush(SRingBuffer* psRingBuffer, void* pvMessage, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferFramePop(SRingBuffer* psRingBuffer, void* pvMessage, BUFFER_INDEX uiMaxLength);
+BUFFER_INDEX	BufferFramePeek(SRingBuffer* psRingBuffer, void** ppvMessage);
+BOOL			BufferFrameConsume(SRingBuffer* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_FRAME_H_
@@ -0,0 +1,529 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferGrow.c
+// 	Brief 		: 	Growable ring buffer. When a push does not fit, a data storage twice as large is
+//					allocated and becomes the new generation: the pushes go to it while the consumers
+//					drain the old generation first, so the elements keep their order and neither side
+//					waits for a copy of the whole buffer. Growing again before the old generation is
+//					drained merges both into the new one. Optionally the buffer shrinks back the same
+//					way after a sustained low occupancy
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Grow while the old generation is draining
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdlib.h>
+#include "RingBufferGrow.h"
+
+#if (RING_BUFFER_ENABLE_LOCKS != 1)
+	#error "RingBufferGrow.c requires RING_BUFFER_ENABLE_LOCKS to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Ring buffer of a generation
+#define GROW_RING(ps, uiGeneration)			(&(ps)->asGeneration[(uiGeneration)].sRingBuffer)
+
+// Generation receiving the pushes, and the one drained before it
+#define GROW_PUSH_RING(ps)					GROW_RING((ps), (ps)->uiPushGeneration)
+#define GROW_DRAIN_RING(ps)					GROW_RING((ps), (ps)->uiDrainGeneration)
+
+// Size in byte of the data storage of a generation, rounded up to the cache line for aligned_alloc
+#define GROW_STORAGE_BYTES(ps, uiSize)		(((size_t)(uiSize) * (ps)->uiElementSize + RING_BUFFER_CACHE_LINE_SIZE - 1) & ~(size_t)(RING_BUFFER_CACHE_LINE_SIZE - 1))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static BOOL		BufferGrowOpen(SRingBufferGrow* psGrow, UINT16 uiGeneration, BUFFER_INDEX uiSize);
+static void		BufferGrowClose(SRingBufferGrow* psGrow, UINT16 uiGeneration);
+static BOOL		BufferGrowResize(SRingBufferGrow* psGrow, BUFFER_INDEX uiSize);
+static void		BufferGrowMerge(SRingBufferGrow* psGrow, UINT16 uiGeneration);
+static BOOL		BufferGrowExpand(SRingBufferGrow* psGrow, BUFFER_INDEX uiLength);
+static void		BufferGrowRetire(SRingBufferGrow* psGrow);
+static void		BufferGrowShrink(SRingBufferGrow* psGrow);
+static BOOL		BufferGrowIsLow(SRingBufferGrow* psGrow);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a growable ring buffer
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	:	uiMinSize is the number of elements of the first generation. A power of two keeps
+//				the masked indexing in every generation
+//	@param	:	uiMaxSize is the maximum number of elements of a generation. The sizes of the
+//				generations are uiMinSize times a power of two, up to uiMaxSize
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@param	:	uiLockPolicy is the lock of each generation (BUFFER_LOCK_xxx), BUFFER_LOCK_CALLBACK
+//				for a single thread
+//	@param	:	bShrink is TRUE to halve the size after RING_BUFFER_GROW_SHRINK_POPS consecutive pops
+//				at a quarter of the size or less, down to uiMinSize
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferGrowInit(SRingBufferGrow* psGrow,
+					BUFFER_INDEX uiMinSize,
+					BUFFER_INDEX uiMaxSize,
+					UINT16 uiElementSize,
+					BUFFER_LOCK_POLICY uiLockPolicy,
+					BOOL bShrink)
+{
+	UINT16	uiGeneration	= 0;
+
+	if ((uiMinSize == 0) || (uiMinSize > uiMaxSize) || (uiElementSize == 0))
+	{
+		return FALSE;
+	}
+
+#if (RING_BUFFER_POWER_OF_TWO == 1)
+	if ((uiMinSize & (uiMinSize - 1)) != 0)
+	{
+		return FALSE;
+	}
+#endif
+
+	if (pthread_rwlock_init(&psGrow->sRwLock, NULL) != 0)
+	{
+		return FALSE;
+	}
+
+	psGrow->uiPushGeneration	= 0;
+	psGrow->uiDrainGeneration	= 0;
+	psGrow->bDraining			= FALSE;
+	psGrow->uiMinSize			= uiMinSize;
+	psGrow->uiMaxSize			= uiMaxSize;
+	psGrow->uiElementSize		= uiElementSize;
+	psGrow->uiLockPolicy		= uiLockPolicy;
+	psGrow->bShrink				= bShrink;
+	psGrow->uiLowPops			= 0;
+
+	for (uiGeneration = 0; uiGeneration < BUFFER_GROW_GENERATIONS; uiGeneration++)
+	{
+		psGrow->asGeneration[uiGeneration].pvStorage = NULL;
+	}
+
+	if (BufferGrowOpen(psGrow, 0, uiMinSize) == FALSE)
+	{
+		pthread_rwlock_destroy(&psGrow->sRwLock);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release a growable ring buffer
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer, not used by any other thread
+//	@return	: 	Void
+//	@note	:	The elements still in the buffer are lost
+// ---------------------------------------------------------------------------------------------------
+void BufferGrowDeinit(SRingBufferGrow* psGrow)
+{
+	if (psGrow->bDraining == TRUE)
+	{
+		BufferGrowClose(psGrow, psGrow->uiDrainGeneration);
+		psGrow->bDraining = FALSE;
+	}
+
+	BufferGrowClose(psGrow, psGrow->uiPushGeneration);
+	pthread_rwlock_destroy(&psGrow->sRwLock);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into the buffer, growing it if the stream does not fit
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully, FALSE if the buffer cannot grow: the elements and the
+//				stream do not fit in uiMaxSize or the allocation failed
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferGrowPushStream(SRingBufferGrow* psGrow, void* pvStream, BUFFER_INDEX uiLength)
+{
+	BOOL	bResult	= FALSE;
+
+	do
+	{
+		pthread_rwlock_rdlock(&psGrow->sRwLock);
+		bResult = BufferPushStream(GROW_PUSH_RING(psGrow), pvStream, uiLength);
+		pthread_rwlock_unlock(&psGrow->sRwLock);
+
+		if (bResult == TRUE)
+		{
+			return TRUE;
+		}
+	} while (BufferGrowExpand(psGrow, uiLength) == TRUE);
+
+	return FALSE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from the buffer, the old generation first
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	A stream may take its first elements from the old generation and the rest from the
+//				new one. The old generation is released as soon as it is found empty
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferGrowPopStream(SRingBufferGrow* psGrow, void* pvStream, BUFFER_INDEX uiLength)
+{
+	BUFFER_INDEX	uiPopCount	= 0;
+	BOOL			bRetire		= FALSE;
+	BOOL			bShrink		= FALSE;
+
+	pthread_rwlock_rdlock(&psGrow->sRwLock);
+
+	// No push goes to the old generation any more, so once it is found empty it stays empty
+	if (psGrow->bDraining == TRUE)
+	{
+		uiPopCount	= BufferPopStream(GROW_DRAIN_RING(psGrow), pvStream, uiLength);
+		bRetire		= (uiPopCount < uiLength) ? TRUE : FALSE;
+	}
+
+	if (uiPopCount < uiLength)
+	{
+		uiPopCount += BufferPopStream(GROW_PUSH_RING(psGrow),
+									  (UCHAR*)pvStream + (size_t)uiPopCount * psGrow->uiElementSize,
+									  uiLength - uiPopCount);
+	}
+
+	// Count the consecutive pops at a low occupancy, the last one shrinks the buffer
+	if (psGrow->bShrink == TRUE)
+	{
+		if (BufferGrowIsLow(psGrow) == TRUE)
+		{
+			bShrink = (__atomic_add_fetch(&psGrow->uiLowPops, 1, __ATOMIC_RELAXED) == RING_BUFFER_GROW_SHRINK_POPS) ? TRUE : FALSE;
+		}
+		else if (__atomic_load_n(&psGrow->uiLowPops, __ATOMIC_RELAXED) != 0)
+		{
+			__atomic_store_n(&psGrow->uiLowPops, 0, __ATOMIC_RELAXED);
+		}
+	}
+
+	pthread_rwlock_unlock(&psGrow->sRwLock);
+
+	if (bRetire == TRUE)
+	{
+		BufferGrowRetire(psGrow);
+	}
+
+	if (bShrink == TRUE)
+	{
+		BufferGrowShrink(psGrow);
+	}
+
+	return uiPopCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into the buffer, growing it if it is full
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferGrowPush(SRingBufferGrow* psGrow, void* pvData)
+{
+	return BufferGrowPushStream(psGrow, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from the buffer
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferGrowPop(SRingBufferGrow* psGrow, void* pvData)
+{
+	return BufferGrowPopStream(psGrow, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of both generations together
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@return	: 	Element count
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferGrowGetCount(SRingBufferGrow* psGrow)
+{
+	UINT64	uiCount	= 0;
+
+	pthread_rwlock_rdlock(&psGrow->sRwLock);
+
+	uiCount = BufferGetCount(GROW_PUSH_RING(psGrow));
+	if (psGrow->bDraining == TRUE)
+	{
+		uiCount += BufferGetCount(GROW_DRAIN_RING(psGrow));
+	}
+
+	pthread_rwlock_unlock(&psGrow->sRwLock);
+
+	return uiCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the number of elements of the generation receiving the pushes
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@return	: 	Size of the buffer
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferGrowGetSize(SRingBufferGrow* psGrow)
+{
+	BUFFER_INDEX	uiSize	= 0;
+
+	pthread_rwlock_rdlock(&psGrow->sRwLock);
+	uiSize = GROW_PUSH_RING(psGrow)->uiBufferSize;
+	pthread_rwlock_unlock(&psGrow->sRwLock);
+
+	return uiSize;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Allocate the data storage of a generation and initialize its ring buffer
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	: 	uiGeneration is the generation, not in use
+//	@param	:	uiSize is the number of elements of the generation
+//	@return	: 	TRUE if successful and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferGrowOpen(SRingBufferGrow* psGrow, UINT16 uiGeneration, BUFFER_INDEX uiSize)
+{
+	SBufferGrowGeneration*	psGeneration	= &psGrow->asGeneration[uiGeneration];
+
+	psGeneration->pvStorage = aligned_alloc(RING_BUFFER_CACHE_LINE_SIZE, GROW_STORAGE_BYTES(psGrow, uiSize));
+	if (psGeneration->pvStorage == NULL)
+	{
+		return FALSE;
+	}
+
+	if (BufferInitWithLock(&psGeneration->sRingBuffer, psGeneration->pvStorage, uiSize, psGrow->uiElementSize, psGrow->uiLockPolicy) == FALSE)
+	{
+		free(psGeneration->pvStorage);
+		psGeneration->pvStorage = NULL;
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the data storage of a generation
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	: 	uiGeneration is the generation, not used by any other thread
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BufferGrowClose(SRingBufferGrow* psGrow, UINT16 uiGeneration)
+{
+	SBufferGrowGeneration*	psGeneration	= &psGrow->asGeneration[uiGeneration];
+
+	BufferDeinit(&psGeneration->sRingBuffer);
+	free(psGeneration->pvStorage);
+	psGeneration->pvStorage = NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Switch the pushes to a new generation of another size
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer, write-locked
+//	@param	:	uiSize is the number of elements of the new generation. If the old generation is 
+//				still draining, it must hold the elements of both generations
+//	@return	: 	TRUE if successful, FALSE if the allocation failed
+//	@note	:	The current generation is kept for draining if it still holds elements. If another 
+//				generation is draining already, both are merged into the new one instead
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferGrowResize(SRingBufferGrow* psGrow, BUFFER_INDEX uiSize)
+{
+	UINT16	uiOldGeneration	= psGrow->uiPushGeneration;
+	UINT16	uiNewGeneration	= 0;
+
+	// Take a generation not in use, at most two of them are in use here
+	while (psGrow->asGeneration[uiNewGeneration].pvStorage != NULL)
+	{
+		uiNewGeneration++;
+	}
+
+	if (BufferGrowOpen(psGrow, uiNewGeneration, uiSize) == FALSE)
+	{
+		return FALSE;
+	}
+
+	psGrow->uiPushGeneration	= uiNewGeneration;
+	psGrow->uiLowPops			= 0;
+
+	if (psGrow->bDraining == TRUE)
+	{
+		BufferGrowMerge(psGrow, uiOldGeneration);
+	}
+	else if (BufferGetCount(GROW_RING(psGrow, uiOldGeneration)) == 0)
+	{
+		BufferGrowClose(psGrow, uiOldGeneration);
+	}
+	else
+	{
+		psGrow->uiDrainGeneration	= uiOldGeneration;
+		psGrow->bDraining			= TRUE;
+	}
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Move the elements of the draining generation and of the previous push generation into 
+//				the new, empty push generation, then release both
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer, write-locked
+//	@param	:	uiGeneration is the previous push generation
+//	@return	: 	Void
+//	@note	:	The new generation is large enough for both. Being empty, its reserved region is a 
+//				single span, so the elements are popped straight into it
+// ---------------------------------------------------------------------------------------------------
+static void BufferGrowMerge(SRingBufferGrow* psGrow, UINT16 uiGeneration)
+{
+	SRingBuffer*	psDrainRing		= GROW_DRAIN_RING(psGrow);
+	SRingBuffer*	psOldRing		= GROW_RING(psGrow, uiGeneration);
+	BUFFER_INDEX	uiDrainCount	= BufferGetCount(psDrainRing);
+	BUFFER_INDEX	uiOldCount		= BufferGetCount(psOldRing);
+	SBufferSpan		asSpan[BUFFER_SPAN_COUNT];
+
+	BufferReserve(GROW_PUSH_RING(psGrow), uiDrainCount + uiOldCount, asSpan);
+	BufferPopStream(psDrainRing, asSpan[0].pvData, uiDrainCount);
+	BufferPopStream(psOldRing, (UCHAR*)asSpan[0].pvData + (size_t)uiDrainCount * psGrow->uiElementSize, uiOldCount);
+	BufferCommit(GROW_PUSH_RING(psGrow), uiDrainCount + uiOldCount);
+
+	BufferGrowClose(psGrow, psGrow->uiDrainGeneration);
+	BufferGrowClose(psGrow, uiGeneration);
+	psGrow->bDraining = FALSE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Grow the buffer after a push of a stream failed
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@param	:	uiLength is the length of the stream
+//	@return	: 	TRUE if the push should be retried, FALSE if the buffer cannot grow
+//	@note	:	Another producer may have grown the buffer already, then only the retry is needed
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferGrowExpand(SRingBufferGrow* psGrow, BUFFER_INDEX uiLength)
+{
+	BUFFER_INDEX	uiSize		= 0;
+	UINT64			uiNeeded	= uiLength;
+	BOOL			bResult		= FALSE;
+
+	pthread_rwlock_wrlock(&psGrow->sRwLock);
+
+	if (BufferGetAvailableCount(GROW_PUSH_RING(psGrow)) >= uiLength)
+	{
+		bResult = TRUE;
+	}
+	else
+	{
+		// A new generation takes the elements of both generations if the old one is still draining
+		if (psGrow->bDraining == TRUE)
+		{
+			uiNeeded += (UINT64)BufferGetCount(GROW_PUSH_RING(psGrow)) + BufferGetCount(GROW_DRAIN_RING(psGrow));
+		}
+
+		// Double the size until the elements fit in the new generation
+		uiSize = GROW_PUSH_RING(psGrow)->uiBufferSize;
+		do
+		{
+			if (uiSize > psGrow->uiMaxSize / 2)
+			{
+				uiSize = 0;
+				break;
+			}
+			uiSize *= 2;
+		} while (uiSize < uiNeeded);
+
+		if (uiSize != 0)
+		{
+			bResult = BufferGrowResize(psGrow, uiSize);
+		}
+	}
+
+	pthread_rwlock_unlock(&psGrow->sRwLock);
+
+	return bResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the old generation once it is drained
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BufferGrowRetire(SRingBufferGrow* psGrow)
+{
+	pthread_rwlock_wrlock(&psGrow->sRwLock);
+
+	if ((psGrow->bDraining == TRUE) && (BufferGetCount(GROW_DRAIN_RING(psGrow)) == 0))
+	{
+		BufferGrowClose(psGrow, psGrow->uiDrainGeneration);
+		psGrow->bDraining = FALSE;
+	}
+
+	pthread_rwlock_unlock(&psGrow->sRwLock);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Halve the size of the buffer after a sustained low occupancy
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer
+//	@return	: 	Void
+//	@note	:	The conditions are checked again under the write lock
+// ---------------------------------------------------------------------------------------------------
+static void BufferGrowShrink(SRingBufferGrow* psGrow)
+{
+	pthread_rwlock_wrlock(&psGrow->sRwLock);
+
+	if ((BufferGrowIsLow(psGrow) == TRUE) && (psGrow->uiLowPops >= RING_BUFFER_GROW_SHRINK_POPS))
+	{
+		BufferGrowResize(psGrow, GROW_PUSH_RING(psGrow)->uiBufferSize / 2);
+	}
+
+	pthread_rwlock_unlock(&psGrow->sRwLock);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Check if the occupancy of the buffer allows to halve it
+//
+//	@param	: 	psGrow is the structure of the growable ring buffer, locked
+//	@return	: 	TRUE if a single generation holds a quarter of its size or less and it is larger than
+//				the minimum size, FALSE otherwise
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferGrowIsLow(SRingBufferGrow* psGrow)
+{
+	SRingBuffer*	psRingBuffer	= GROW_PUSH_RING(psGrow);
+
+	if ((psGrow->bDraining == TRUE) || (psRingBuffer->uiBufferSize / 2 < psGrow->uiMinSize) ||
+		(BufferGetCount(psRingBuffer) > psRingBuffer->uiBufferSize / 4))
+	{
+		return FALSE;
+	}
+
+	return TRUE;
+}
@@ -0,0 +1,88 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferGrow.h
+// 	Brief 		: 	Growable ring buffer. When a push does not fit, a data storage twice as large is
+//					allocated and becomes the new generation: the pushes go to it while the consumers
+//					drain the old generation first, so the elements keep their order and neither side
+//					waits for a copy of the whole buffer. Growing again before the old generation is
+//					drained merges both into the new one. Optionally the buffer shrinks back the same
+//					way after a sustained low occupancy
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Grow while the old generation is draining
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_GROW_H_
+#define _RING_BUFFER_GROW_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <pthread.h>
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Number of generations alive at once: the one being pushed, the one being drained and the new one
+// which both are merged into
+#define BUFFER_GROW_GENERATIONS		3
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Generation of a growable ring buffer
+typedef struct S_BUFFER_GROW_GENERATION
+{
+	SRingBuffer				sRingBuffer;				// The ring buffer
+	void*					pvStorage;					// Its data storage, allocated
+
+} SBufferGrowGeneration;
+
+// Growable ring buffer
+typedef struct S_RING_BUFFER_GROW
+{
+	SBufferGrowGeneration	asGeneration[BUFFER_GROW_GENERATIONS];	// The generations, pvStorage is NULL if unused
+	UINT16					uiPushGeneration;			// Generation receiving the pushes
+	UINT16					uiDrainGeneration;			// Generation drained before it, valid if bDraining
+	BOOL					bDraining;					// The drained generation still holds elements
+	BUFFER_INDEX			uiMinSize;					// Size of the first generation
+	BUFFER_INDEX			uiMaxSize;					// Maximum size of a generation
+	UINT16					uiElementSize;				// Size in byte of each element
+	BUFFER_LOCK_POLICY		uiLockPolicy;				// Lock of each generation
+	BOOL					bShrink;					// Shrink back after a low occupancy
+	UINT32					uiLowPops;					// Consecutive pops at a low occupancy
+	pthread_rwlock_t		sRwLock;					// Read: push and pop, write: change generation
+
+} SRingBufferGrow;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferGrowInit(SRingBufferGrow* psGrow,
+							   BUFFER_INDEX uiMinSize,
+							   BUFFER_INDEX uiMaxSize,
+							   UINT16 uiElementSize,
+							   BUFFER_LOCK_POLICY uiLockPolicy,
+							   BOOL bShrink);
+void			BufferGrowDeinit(SRingBufferGrow* psGrow);
+
+BOOL 			BufferGrowPushStream(SRingBufferGrow* psGrow, void* pvStream, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferGrowPopStream(SRingBufferGrow* psGrow, void* pvStream, BUFFER_INDEX uiLength);
+BOOL 			BufferGrowPush(SRingBufferGrow* psGrow, void* pvData);
+BUFFER_INDEX	BufferGrowPop(SRingBufferGrow* psGrow, void* pvData);
+UINT64			BufferGrowGetCount(SRingBufferGrow* psGrow);
+BUFFER_INDEX	BufferGrowGetSize(SRingBufferGrow* psGrow);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_GROW_H_
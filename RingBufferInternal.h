@@ -0,0 +1,57 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferInternal.h
+// 	Brief 		: 	Helpers shared by the modules of the ring buffer library: the monotonic clock and
+//					the spin hint
+//	Author 		: 	AnhNH57
+//  Note 		: 	Internal, included by the .c files of the library only and not installed
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_INTERNAL_H_
+#define _RING_BUFFER_INTERNAL_H_
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <time.h>
+#include "TypeDef.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Hint the processor that the caller is spinning
+#if defined(__x86_64__) || defined(__i386__)
+	#define BUFFER_CPU_RELAX()				__builtin_ia32_pause()
+#elif defined(__aarch64__)
+	#define BUFFER_CPU_RELAX()				__asm__ __volatile__("yield")
+#else
+	#define BUFFER_CPU_RELAX()
+#endif
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Read the monotonic clock
+//
+//	@param	: 	None
+//	@return	: 	The current time in nanoseconds
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static inline UINT64 BufferNow(void)
+{
+	struct timespec	sNow;
+
+	clock_gettime(CLOCK_MONOTONIC, &sNow);
+
+	return (UINT64)sNow.tv_sec * 1000000000ULL + (UINT64)sNow.tv_nsec;
+}
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+#endif	// _RING_BUFFER_INTERNAL_H_
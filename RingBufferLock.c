@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferLock.c
+// 	Brief 		: 	Built-in locks of the ring buffer: a ticket spinlock, a pthread mutex and an adaptive
+//					lock which spins for a while and then parks on a futex. The uncontended paths are
+//					inlined, so a locked SRingBuffer takes no indirect call
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Take the spin hint from RingBufferInternal.h
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "RingBufferLock.h"
+#include "RingBufferInternal.h"
+
+#if (RING_BUFFER_ENABLE_LOCKS != 1)
+	#error "RingBufferLock.c requires RING_BUFFER_ENABLE_LOCKS to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Create a built-in lock
+//
+//	@param	: 	psLock is the lock
+//	@param	: 	uiPolicy is the policy of the lock, one of BUFFER_LOCK_xxx
+//	@return	: 	TRUE if creating successfully and vice versa
+//	@note	:	BUFFER_LOCK_CALLBACK creates nothing, the lock is then left to the call-back functions
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferLockCreate(SBufferLock* psLock, BUFFER_LOCK_POLICY uiPolicy)
+{
+	psLock->uiPolicy		= BUFFER_LOCK_CALLBACK;
+	psLock->uiTicketNext	= 0;
+	psLock->uiTicketOwner	= 0;
+	psLock->iFutex			= 0;
+
+	switch (uiPolicy)
+	{
+		case BUFFER_LOCK_CALLBACK:
+		case BUFFER_LOCK_TICKET:
+		case BUFFER_LOCK_ADAPTIVE:
+			break;
+
+		case BUFFER_LOCK_MUTEX:
+			if (pthread_mutex_init(&psLock->sMutex, NULL) != 0)
+			{
+				return FALSE;
+			}
+			break;
+
+		default:
+			return FALSE;
+	}
+
+	psLock->uiPolicy = uiPolicy;
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Destroy a built-in lock
+//
+//	@param	: 	psLock is the lock, not held by anybody
+//	@return	: 	Void
+//	@note	:	The lock falls back to BUFFER_LOCK_CALLBACK
+// ---------------------------------------------------------------------------------------------------
+void BufferLockDestroy(SBufferLock* psLock)
+{
+	if (psLock->uiPolicy == BUFFER_LOCK_MUTEX)
+	{
+		pthread_mutex_destroy(&psLock->sMutex);
+	}
+
+	psLock->uiPolicy = BUFFER_LOCK_CALLBACK;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Wait for the turn of a ticket of a ticket spinlock
+//
+//	@param	: 	psLock is the lock
+//	@param	: 	uiTicket is the ticket taken by BufferLockAcquire
+//	@return	: 	Void
+//	@note	:	The CPU is given up every RING_BUFFER_LOCK_SPIN_COUNT checks so that a preempted
+//				holder, or the waiter just ahead, can run
+// ---------------------------------------------------------------------------------------------------
+void BufferLockWaitTicket(SBufferLock* psLock, UINT32 uiTicket)
+{
+	UINT32	uiSpin	= 0;
+
+	while (__atomic_load_n(&psLock->uiTicketOwner, __ATOMIC_ACQUIRE) != uiTicket)
+	{
+		if (++uiSpin < RING_BUFFER_LOCK_SPIN_COUNT)
+		{
+			BUFFER_CPU_RELAX();
+		}
+		else
+		{
+			uiSpin = 0;
+			sched_yield();
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Take an adaptive lock which is held by another thread
+//
+//	@param	: 	psLock is the lock
+//	@return	: 	Void
+//	@note	:	Spins RING_BUFFER_LOCK_SPIN_COUNT times for short critical sections, then marks the
+//				lock as having sleepers and parks on the futex until it is released
+// ---------------------------------------------------------------------------------------------------
+void BufferLockWaitAdaptive(SBufferLock* psLock)
+{
+	UINT32	uiSpin		= 0;
+	int		iExpected	= 0;
+
+	for (uiSpin = 0; uiSpin < RING_BUFFER_LOCK_SPIN_COUNT; uiSpin++)
+	{
+		iExpected = 0;
+		if ((__atomic_load_n(&psLock->iFutex, __ATOMIC_RELAXED) == 0) &&
+			__atomic_compare_exchange_n(&psLock->iFutex, &iExpected, 1, FALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+		{
+			return;
+		}
+
+		BUFFER_CPU_RELAX();
+	}
+
+	// Taken with the sleeper mark, the lock is released with a wake-up even if nobody sleeps any more
+	while (__atomic_exchange_n(&psLock->iFutex, 2, __ATOMIC_ACQUIRE) != 0)
+	{
+		syscall(SYS_futex, &psLock->iFutex, FUTEX_WAIT_PRIVATE, 2, NULL, NULL, 0);
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Wake up a thread parked on an adaptive lock
+//
+//	@param	: 	psLock is the lock, just released
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+void BufferLockWakeAdaptive(SBufferLock* psLock)
+{
+	syscall(SYS_futex, &psLock->iFutex, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
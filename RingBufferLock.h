@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferLock.h
+// 	Brief 		: 	Built-in locks of the ring buffer: a ticket spinlock, a pthread mutex and an adaptive
+//					lock which spins for a while and then parks on a futex. The uncontended paths are
+//					inlined, so a locked SRingBuffer takes no indirect call
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_LOCK_H_
+#define _RING_BUFFER_LOCK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <pthread.h>
+#include "TypeDef.h"
+#include "RingBufferConfig.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Lock policies of BufferLockCreate
+#define BUFFER_LOCK_CALLBACK		0		// No built-in lock, the call-back functions of BufferInit are used
+#define BUFFER_LOCK_TICKET			1		// Ticket spinlock, first come first served
+#define BUFFER_LOCK_MUTEX			2		// pthread mutex
+#define BUFFER_LOCK_ADAPTIVE		3		// Spins RING_BUFFER_LOCK_SPIN_COUNT times, then parks on a futex
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Lock policy, one of BUFFER_LOCK_xxx
+typedef UINT16				BUFFER_LOCK_POLICY;
+
+// Built-in lock
+typedef struct S_BUFFER_LOCK
+{
+	BUFFER_LOCK_POLICY		uiPolicy;					// Policy selected by BufferLockCreate
+	UINT32					uiTicketNext;				// Next ticket to be taken (ticket spinlock)
+	UINT32					uiTicketOwner;				// Ticket holding the lock (ticket spinlock)
+	int						iFutex;						// 0 free, 1 locked, 2 locked with sleepers (adaptive)
+	pthread_mutex_t			sMutex;						// The mutex (pthread mutex)
+
+} SBufferLock;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferLockCreate(SBufferLock* psLock, BUFFER_LOCK_POLICY uiPolicy);
+void			BufferLockDestroy(SBufferLock* psLock);
+
+void			BufferLockWaitTicket(SBufferLock* psLock, UINT32 uiTicket);
+void			BufferLockWaitAdaptive(SBufferLock* psLock);
+void			BufferLockWakeAdaptive(SBufferLock* psLock);
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Take a built-in lock
+//
+//	@param	: 	psLock is the lock, created by BufferLockCreate with a policy other than
+//				BUFFER_LOCK_CALLBACK
+//	@return	: 	Void
+//	@note	:	Only the contended paths leave the caller
+// ---------------------------------------------------------------------------------------------------
+static inline void BufferLockAcquire(SBufferLock* psLock)
+{
+	UINT32	uiTicket	= 0;
+	int		iExpected	= 0;
+
+	switch (psLock->uiPolicy)
+	{
+		case BUFFER_LOCK_TICKET:
+			uiTicket = __atomic_fetch_add(&psLock->uiTicketNext, 1, __ATOMIC_RELAXED);
+			if (__atomic_load_n(&psLock->uiTicketOwner, __ATOMIC_ACQUIRE) != uiTicket)
+			{
+				BufferLockWaitTicket(psLock, uiTicket);
+			}
+			break;
+
+		case BUFFER_LOCK_MUTEX:
+			pthread_mutex_lock(&psLock->sMutex);
+			break;
+
+		default:
+			if (!__atomic_compare_exchange_n(&psLock->iFutex, &iExpected, 1, FALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+			{
+				BufferLockWaitAdaptive(psLock);
+			}
+			break;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release a built-in lock
+//
+//	@param	: 	psLock is the lock, held by the caller
+//	@return	: 	Void
+//	@note	:	The adaptive lock only enters the kernel if a waiter is parked
+// ---------------------------------------------------------------------------------------------------
+static inline void BufferLockRelease(SBufferLock* psLock)
+{
+	switch (psLock->uiPolicy)
+	{
+		case BUFFER_LOCK_TICKET:
+			// Only the holder writes the owner ticket
+			__atomic_store_n(&psLock->uiTicketOwner, __atomic_load_n(&psLock->uiTicketOwner, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE);
+			break;
+
+		case BUFFER_LOCK_MUTEX:
+			pthread_mutex_unlock(&psLock->sMutex);
+			break;
+
+		default:
+			if (__atomic_exchange_n(&psLock->iFutex, 0, __ATOMIC_RELEASE) == 2)
+			{
+				BufferLockWakeAdaptive(psLock);
+			}
+			break;
+	}
+}
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_LOCK_H_
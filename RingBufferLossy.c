@@ -0,0 +1,296 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferLossy.c
+// 	Brief 		: 	Overwrite-oldest ring buffer for telemetry and "latest N samples" data. The single
+//					producer never blocks: when the buffer is full the oldest element is overwritten.
+//					Each reader keeps its own pop pointer and detects overrun through the write
+//					sequence of the slots, so it reports lost elements instead of reading torn data
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Never skip a reader past the published push pointer
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <string.h>
+#include "RingBufferLossy.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Slot sequence while the element of push pointer uiPtr is being written, and once it is complete.
+// A reader expecting element uiPtr accepts the slot only if it reads LOSSY_DONE(uiPtr) both before
+// and after copying the data out
+#define LOSSY_BUSY(uiPtr)				(2 * (UINT64)(uiPtr) + 1)
+#define LOSSY_DONE(uiPtr)				(2 * (UINT64)(uiPtr) + 2)
+
+// Push pointer of the element a slot sequence belongs to
+#define LOSSY_PTR(uiSequence)			(((uiSequence) - 1) / 2)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static void		BufferLossyWrite(SRingBufferLossy* psRingBuffer, UINT64 uiPushPtr, void* pvData);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize an overwrite-oldest ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStorage is the storage area, at least BUFFER_LOSSY_STORAGE_SIZE() bytes long
+//	@param	:	uiBufferSize is the length of buffer or the number of elements in the buffer. It must
+//				be a power of two
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	Must be called before the producer or any reader thread is started
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferLossyInit(SRingBufferLossy* psRingBuffer,
+					 void* pvStorage,
+					 UINT16 uiBufferSize,
+					 UINT16 uiElementSize)
+{
+	UINT16	uiIndex	= 0;
+
+	// The pointers are wrapped by masking, so the size must be a power of two
+	if ((uiBufferSize == 0) || ((uiBufferSize & (uiBufferSize - 1)) != 0))
+	{
+		return FALSE;
+	}
+
+	// Initialize data for the Ring buffer structure
+	psRingBuffer->puiSequence		= (_Atomic UINT64*)pvStorage;
+	psRingBuffer->pvBuffer			= (UCHAR*)pvStorage + uiBufferSize * sizeof(_Atomic UINT64);
+	psRingBuffer->uiBufferSize		= uiBufferSize;
+	psRingBuffer->uiBufferMask		= uiBufferSize - 1;
+	psRingBuffer->uiElementSize		= uiElementSize;
+
+	// No slot holds an element yet
+	for (uiIndex = 0; uiIndex < uiBufferSize; uiIndex++)
+	{
+		atomic_init(&psRingBuffer->puiSequence[uiIndex], 0);
+	}
+
+	atomic_init(&psRingBuffer->uiBufferPushPtr, 0);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a reader of an overwrite-oldest ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	psReader is the reader, it starts at the oldest element still in the buffer
+//	@return	: 	Void
+//	@note	:	Readers can join at any time, each one sees every element pushed after it joined
+//				unless the element is overwritten first
+// ---------------------------------------------------------------------------------------------------
+void BufferLossyReaderInit(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader)
+{
+	UINT64	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+
+	psReader->uiBufferPopPtr	= (uiPushPtr > psRingBuffer->uiBufferSize) ? (uiPushPtr - psRingBuffer->uiBufferSize) : 0;
+	psReader->uiLostCount		= 0;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer, overwriting the oldest elements if it is full
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	Void
+//	@note	:	Only one producer thread may push. If uiLength is larger than the buffer, only the last
+//				uiBufferSize elements survive
+// ---------------------------------------------------------------------------------------------------
+void BufferLossyPushStream(SRingBufferLossy* psRingBuffer, void* pvStream, UINT16 uiLength)
+{
+	UINT64	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+	UINT16	uiIndex		= 0;
+
+	// The elements which would be overwritten by the same stream are not written at all
+	if (uiLength > psRingBuffer->uiBufferSize)
+	{
+		uiIndex = uiLength - psRingBuffer->uiBufferSize;
+	}
+
+	for (; uiIndex < uiLength; uiIndex++)
+	{
+		BufferLossyWrite(psRingBuffer, uiPushPtr + uiIndex, (UCHAR*)pvStream + uiIndex * psRingBuffer->uiElementSize);
+	}
+
+	// Publish the elements to the readers
+	atomic_store_explicit(&psRingBuffer->uiBufferPushPtr, uiPushPtr + uiLength, memory_order_release);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer, overwriting the oldest one if it is full
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	Void
+//	@note	:	Only one producer thread may push
+// ---------------------------------------------------------------------------------------------------
+void BufferLossyPush(SRingBufferLossy* psRingBuffer, void* pvData)
+{
+	UINT64	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+
+	BufferLossyWrite(psRingBuffer, uiPushPtr, pvData);
+
+	// Publish the element to the readers
+	atomic_store_explicit(&psRingBuffer->uiBufferPushPtr, uiPushPtr + 1, memory_order_release);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	psReader is the reader
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Elements overwritten in the meantime are skipped and added to the lost count
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferLossyPopStream(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader, void* pvStream, UINT16 uiLength)
+{
+	UINT16	uiPopCount	= 0;
+
+	while ((uiPopCount < uiLength) &&
+		   (BufferLossyPop(psRingBuffer, psReader, (UCHAR*)pvStream + uiPopCount * psRingBuffer->uiElementSize) != 0))
+	{
+		uiPopCount++;
+	}
+
+	return uiPopCount;	// Return the number of elements popped out actually
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out the oldest data element the reader has not read yet
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	psReader is the reader
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:	If the producer has lapped the reader, the pop pointer is pushed ahead to the oldest
+//				element still in the buffer and the skipped elements are added to the lost count. An
+//				element overwritten while it is being copied out is dropped the same way, never
+//				returned torn
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferLossyPop(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader, void* pvData)
+{
+	UINT64	uiPushPtr	= 0;
+	UINT64	uiPopPtr	= psReader->uiBufferPopPtr;
+	UINT64	uiSequence	= 0;
+	UINT64	uiOldest	= 0;
+	UINT16	uiSlot		= 0;
+
+	for (;;)
+	{
+		uiPushPtr = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+		if (uiPopPtr == uiPushPtr)
+		{
+			psReader->uiBufferPopPtr = uiPopPtr;
+			return 0;		// Buffer is empty
+		}
+
+		// The producer has lapped the reader, skip to the oldest element still in the buffer
+		if (uiPushPtr - uiPopPtr > psRingBuffer->uiBufferSize)
+		{
+			uiOldest				= uiPushPtr - psRingBuffer->uiBufferSize;
+			psReader->uiLostCount	+= uiOldest - uiPopPtr;
+			uiPopPtr				= uiOldest;
+		}
+
+		uiSlot		= uiPopPtr & psRingBuffer->uiBufferMask;
+		uiSequence	= atomic_load_explicit(&psRingBuffer->puiSequence[uiSlot], memory_order_acquire);
+		if (uiSequence == LOSSY_DONE(uiPopPtr))
+		{
+			memcpy(pvData, (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize, psRingBuffer->uiElementSize);
+
+			// The copy is valid only if the slot was not rewritten meanwhile
+			atomic_thread_fence(memory_order_acquire);
+			uiSequence = atomic_load_explicit(&psRingBuffer->puiSequence[uiSlot], memory_order_relaxed);
+			if (uiSequence == LOSSY_DONE(uiPopPtr))
+			{
+				psReader->uiBufferPopPtr = uiPopPtr + 1;
+				return 1;
+			}
+		}
+
+		// The slot is being (or has been) rewritten by a later lap: everything up to the element
+		// the producer is writing into it, minus one buffer length, is lost. That element may not
+		// be published yet, so never skip past the push pointer
+		uiOldest = LOSSY_PTR(uiSequence) + 1 - psRingBuffer->uiBufferSize;
+		if (uiOldest > uiPushPtr)
+		{
+			uiOldest = uiPushPtr;
+		}
+		psReader->uiLostCount	+= uiOldest - uiPopPtr;
+		uiPopPtr				= uiOldest;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the number of elements the reader can still pop
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	psReader is the reader
+//	@return	: 	Element count of the buffer not read yet by the reader
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferLossyGetCount(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader)
+{
+	UINT64	uiCount	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire) - psReader->uiBufferPopPtr;
+
+	if (uiCount > psRingBuffer->uiBufferSize)
+	{
+		return psRingBuffer->uiBufferSize;
+	}
+
+	return (UINT16)uiCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the number of elements the reader has lost since the previous call
+//
+//	@param	: 	psReader is the reader
+//	@return	: 	Number of elements overwritten before the reader could pop them
+//	@note	:	The lost count of the reader is cleared
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferLossyGetLostCount(SRingBufferLossyReader* psReader)
+{
+	UINT64	uiLostCount	= psReader->uiLostCount;
+
+	psReader->uiLostCount = 0;
+
+	return uiLostCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Write a data element into its slot
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiPushPtr is the push pointer of the element
+//	@param	: 	pvData is the data to be written
+//	@return	: 	Void
+//	@note	:	The slot sequence is odd while the data is written, so a reader copying the slot out
+//				at the same time sees it change and drops its copy
+// ---------------------------------------------------------------------------------------------------
+static void BufferLossyWrite(SRingBufferLossy* psRingBuffer, UINT64 uiPushPtr, void* pvData)
+{
+	UINT16	uiSlot	= uiPushPtr & psRingBuffer->uiBufferMask;
+
+	atomic_store_explicit(&psRingBuffer->puiSequence[uiSlot], LOSSY_BUSY(uiPushPtr), memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	memcpy((UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize, pvData, psRingBuffer->uiElementSize);
+
+	atomic_store_explicit(&psRingBuffer->puiSequence[uiSlot], LOSSY_DONE(uiPushPtr), memory_order_release);
+}
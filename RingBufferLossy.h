@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferLossy.h
+// 	Brief 		: 	Overwrite-oldest ring buffer for telemetry and "latest N samples" data. The single
+//					producer never blocks: when the buffer is full the oldest element is overwritten.
+//					Each reader keeps its own pop pointer and detects overrun through the write
+//					sequence of the slots, so it reports lost elements instead of reading torn data
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Align with BUFFER_ALIGNED instead of _Alignas
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_LOSSY_H_
+#define _RING_BUFFER_LOSSY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdatomic.h>
+#include "TypeDef.h"
+#include "RingBufferConfig.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Overwrite-oldest ring buffer structure
+typedef struct S_RING_BUFFER_LOSSY
+{
+	// Read-only after initialization
+	_Atomic UINT64*			puiSequence;				// Write sequence of each element slot
+	void*					pvBuffer;					// Data buffer
+	UINT16					uiBufferSize;				// Size of buffer or the total of elements
+	UINT16					uiBufferMask;				// uiBufferSize - 1, used to wrap the pointers
+	UINT16					uiElementSize;				// Size of each element of the buffer in byte
+
+	// Written by the producer only
+	BUFFER_ALIGNED
+	_Atomic UINT64			uiBufferPushPtr;			// Number of elements pushed since initialization
+
+} SRingBufferLossy;
+
+// Reader of an overwrite-oldest ring buffer, owned by one consumer thread
+typedef struct S_RING_BUFFER_LOSSY_READER
+{
+	UINT64					uiBufferPopPtr;				// The pointer to start reading
+	UINT64					uiLostCount;				// Elements overwritten before they were read
+
+} SRingBufferLossyReader;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Size in byte of the storage area needed by BufferLossyInit: the slot sequences followed by the
+// element data
+#define BUFFER_LOSSY_STORAGE_SIZE(uiBufferSize, uiElementSize)	\
+			((uiBufferSize) * (sizeof(_Atomic UINT64) + (uiElementSize)))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferLossyInit(SRingBufferLossy* psRingBuffer,
+								void* pvStorage,
+								UINT16 uiBufferSize,
+								UINT16 uiElementSize);
+void			BufferLossyReaderInit(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader);
+
+void 			BufferLossyPushStream(SRingBufferLossy* psRingBuffer, void* pvStream, UINT16 uiLength);
+void 			BufferLossyPush(SRingBufferLossy* psRingBuffer, void* pvData);
+UINT16 			BufferLossyPopStream(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader, void* pvStream, UINT16 uiLength);
+UINT16			BufferLossyPop(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader, void* pvData);
+UINT16			BufferLossyGetCount(SRingBufferLossy* psRingBuffer, SRingBufferLossyReader* psReader);
+UINT64			BufferLossyGetLostCount(SRingBufferLossyReader* psReader);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_LOSSY_H_
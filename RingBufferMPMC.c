@@ -0,0 +1,376 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferMPMC.c
+// 	Brief 		: 	Lock-free multi-producer/multi-consumer ring buffer. Each element slot carries a
+//					sequence number and producers/consumers claim slots by CAS on the push/pop
+//					tickets, so no lock is taken by any thread
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <string.h>
+#include "RingBufferMPMC.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Signed distance between a slot sequence number and the ticket expected by the caller:
+// 0 means the slot is ready for the caller, < 0 means the slot is still in use by the previous lap,
+// > 0 means another thread has already taken the ticket
+#define MPMC_DIFF(uiSequence, uiTicket)		((INT16)((UINT16)((uiSequence) - (uiTicket))))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static void		BufferMPMCCopyIn(SRingBufferMPMC* psRingBuffer, UINT16 uiTicket, void* pvStream, UINT16 uiLength);
+static void		BufferMPMCCopyOut(SRingBufferMPMC* psRingBuffer, UINT16 uiTicket, void* pvStream, UINT16 uiLength);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a multi-producer/multi-consumer ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStorage is the storage area, at least BUFFER_MPMC_STORAGE_SIZE() bytes long
+//	@param	:	uiBufferSize is the length of buffer or the number of elements in the buffer. It must
+//				be a power of two
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	Must be called before any producer or consumer thread is started
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferMPMCInit(SRingBufferMPMC* psRingBuffer,
+					void* pvStorage,
+					UINT16 uiBufferSize,
+					UINT16 uiElementSize)
+{
+	UINT16	uiIndex	= 0;
+
+	// The tickets are wrapped by masking, so the size must be a power of two
+	if ((uiBufferSize == 0) || ((uiBufferSize & (uiBufferSize - 1)) != 0))
+	{
+		return FALSE;
+	}
+
+	// Initialize data for the Ring buffer structure
+	psRingBuffer->puiSequence		= (_Atomic UINT16*)pvStorage;
+	psRingBuffer->pvBuffer			= (UCHAR*)pvStorage + uiBufferSize * sizeof(_Atomic UINT16);
+	psRingBuffer->uiBufferSize		= uiBufferSize;
+	psRingBuffer->uiBufferMask		= uiBufferSize - 1;
+	psRingBuffer->uiElementSize		= uiElementSize;
+
+	// Every slot is ready to be pushed by the ticket of the same number
+	for (uiIndex = 0; uiIndex < uiBufferSize; uiIndex++)
+	{
+		atomic_init(&psRingBuffer->puiSequence[uiIndex], uiIndex);
+	}
+
+	atomic_init(&psRingBuffer->uiBufferPushPtr, 0);
+	atomic_init(&psRingBuffer->uiBufferPopPtr, 0);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer. The stream is pushed entirely or not at all
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferMPMCPushStream(SRingBufferMPMC* psRingBuffer, void* pvStream, UINT16 uiLength)
+{
+	UINT16	uiTicket	= 0;
+	UINT16	uiIndex		= 0;
+	INT16	iDiff		= 0;
+
+	if (uiLength > psRingBuffer->uiBufferSize)
+	{
+		return FALSE;
+	}
+
+	uiTicket = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+	for (;;)
+	{
+		// All slots of the claim must be free for this lap before the tickets are taken
+		for (uiIndex = 0; uiIndex < uiLength; uiIndex++)
+		{
+			iDiff = MPMC_DIFF(atomic_load_explicit(&psRingBuffer->puiSequence[(uiTicket + uiIndex) & psRingBuffer->uiBufferMask], memory_order_acquire), uiTicket + uiIndex);
+			if (iDiff != 0)
+			{
+				break;
+			}
+		}
+
+		if (uiIndex == uiLength)
+		{
+			if (atomic_compare_exchange_weak_explicit(&psRingBuffer->uiBufferPushPtr, &uiTicket, uiTicket + uiLength, memory_order_relaxed, memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (iDiff < 0)
+		{
+			return FALSE;	// Not enough room
+		}
+		else
+		{
+			// Another producer has taken the ticket, retry from the current one
+			uiTicket = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+		}
+	}
+
+	BufferMPMCCopyIn(psRingBuffer, uiTicket, pvStream, uiLength);
+
+	// Publish the slots to the consumers
+	for (uiIndex = 0; uiIndex < uiLength; uiIndex++)
+	{
+		atomic_store_explicit(&psRingBuffer->puiSequence[(uiTicket + uiIndex) & psRingBuffer->uiBufferMask], uiTicket + uiIndex + 1, memory_order_release);
+	}
+
+	return TRUE;	// Push successfully
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Only the consecutive elements which are completely pushed are popped out
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferMPMCPopStream(SRingBufferMPMC* psRingBuffer, void* pvStream, UINT16 uiLength)
+{
+	UINT16	uiTicket	= 0;
+	UINT16	uiPopCount	= 0;
+	UINT16	uiIndex		= 0;
+	INT16	iDiff		= 0;
+
+	uiTicket = atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_relaxed);
+	for (;;)
+	{
+		// Count the ready slots starting at the ticket
+		iDiff = 0;
+		for (uiPopCount = 0; uiPopCount < uiLength; uiPopCount++)
+		{
+			iDiff = MPMC_DIFF(atomic_load_explicit(&psRingBuffer->puiSequence[(uiTicket + uiPopCount) & psRingBuffer->uiBufferMask], memory_order_acquire), uiTicket + uiPopCount + 1);
+			if (iDiff != 0)
+			{
+				break;
+			}
+		}
+
+		if (iDiff > 0)
+		{
+			// Another consumer has taken the ticket, retry from the current one
+			uiTicket = atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_relaxed);
+		}
+		else if (uiPopCount == 0)
+		{
+			return 0;		// Buffer is empty
+		}
+		else if (atomic_compare_exchange_weak_explicit(&psRingBuffer->uiBufferPopPtr, &uiTicket, uiTicket + uiPopCount, memory_order_relaxed, memory_order_relaxed))
+		{
+			break;
+		}
+	}
+
+	BufferMPMCCopyOut(psRingBuffer, uiTicket, pvStream, uiPopCount);
+
+	// Hand the slots back to the producers for the next lap
+	for (uiIndex = 0; uiIndex < uiPopCount; uiIndex++)
+	{
+		atomic_store_explicit(&psRingBuffer->puiSequence[(uiTicket + uiIndex) & psRingBuffer->uiBufferMask], uiTicket + uiIndex + psRingBuffer->uiBufferSize, memory_order_release);
+	}
+
+	return uiPopCount;	// Return the number of elements popped out actually
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferMPMCPush(SRingBufferMPMC* psRingBuffer, void* pvData)
+{
+	UINT16	uiTicket	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+	UINT16	uiSlot		= 0;
+	INT16	iDiff		= 0;
+
+	for (;;)
+	{
+		uiSlot	= uiTicket & psRingBuffer->uiBufferMask;
+		iDiff	= MPMC_DIFF(atomic_load_explicit(&psRingBuffer->puiSequence[uiSlot], memory_order_acquire), uiTicket);
+		if (iDiff == 0)
+		{
+			if (atomic_compare_exchange_weak_explicit(&psRingBuffer->uiBufferPushPtr, &uiTicket, uiTicket + 1, memory_order_relaxed, memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (iDiff < 0)
+		{
+			return FALSE;	// Buffer is full
+		}
+		else
+		{
+			uiTicket = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+		}
+	}
+
+	// Push data element and publish the slot to the consumers
+	memcpy((UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize, pvData, psRingBuffer->uiElementSize);
+	atomic_store_explicit(&psRingBuffer->puiSequence[uiSlot], uiTicket + 1, memory_order_release);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferMPMCPop(SRingBufferMPMC* psRingBuffer, void* pvData)
+{
+	UINT16	uiTicket	= atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_relaxed);
+	UINT16	uiSlot		= 0;
+	INT16	iDiff		= 0;
+
+	for (;;)
+	{
+		uiSlot	= uiTicket & psRingBuffer->uiBufferMask;
+		iDiff	= MPMC_DIFF(atomic_load_explicit(&psRingBuffer->puiSequence[uiSlot], memory_order_acquire), uiTicket + 1);
+		if (iDiff == 0)
+		{
+			if (atomic_compare_exchange_weak_explicit(&psRingBuffer->uiBufferPopPtr, &uiTicket, uiTicket + 1, memory_order_relaxed, memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (iDiff < 0)
+		{
+			return 0;		// Buffer is empty
+		}
+		else
+		{
+			uiTicket = atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_relaxed);
+		}
+	}
+
+	// Pop data element and hand the slot back to the producers for the next lap
+	memcpy(pvData, (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize, psRingBuffer->uiElementSize);
+	atomic_store_explicit(&psRingBuffer->puiSequence[uiSlot], uiTicket + psRingBuffer->uiBufferSize, memory_order_release);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of the buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Element count of the buffer, including elements which are still being pushed
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferMPMCGetCount(SRingBufferMPMC* psRingBuffer)
+{
+	UINT16	uiPopPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_acquire);
+	UINT16	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+	INT16	iCount		= (INT16)(UINT16)(uiPushPtr - uiPopPtr);
+
+	// The two tickets are not read atomically together, so clamp the result into the valid range
+	if (iCount < 0)
+	{
+		return 0;
+	}
+	if ((UINT16)iCount > psRingBuffer->uiBufferSize)
+	{
+		return psRingBuffer->uiBufferSize;
+	}
+
+	return (UINT16)iCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the available (free or can be used for pushing) element count of the buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Available element count of the buffer
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferMPMCGetAvailableCount(SRingBufferMPMC* psRingBuffer)
+{
+	return psRingBuffer->uiBufferSize - BufferMPMCGetCount(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy a stream into the element slots claimed by a ticket
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiTicket is the ticket of the first claimed slot
+//	@param	: 	pvStream is the data stream to be copied
+//	@param	:	uiLength is the number of claimed slots
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BufferMPMCCopyIn(SRingBufferMPMC* psRingBuffer, UINT16 uiTicket, void* pvStream, UINT16 uiLength)
+{
+	UINT16	uiSlot			= uiTicket & psRingBuffer->uiBufferMask;
+	UINT16	uiFirstLength	= psRingBuffer->uiBufferSize - uiSlot;
+	UCHAR*	pvBuffer		= (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize;
+
+	// If the claimed slots wrap around the end of the buffer then we need to copy twice
+	if (uiLength > uiFirstLength)
+	{
+		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy(psRingBuffer->pvBuffer, (UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->uiElementSize * (uiLength - uiFirstLength));
+	}
+	else
+	{
+		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiLength);
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy the element slots claimed by a ticket out to a stream
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	uiTicket is the ticket of the first claimed slot
+//	@param	: 	pvStream is the destination data stream
+//	@param	:	uiLength is the number of claimed slots
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BufferMPMCCopyOut(SRingBufferMPMC* psRingBuffer, UINT16 uiTicket, void* pvStream, UINT16 uiLength)
+{
+	UINT16	uiSlot			= uiTicket & psRingBuffer->uiBufferMask;
+	UINT16	uiFirstLength	= psRingBuffer->uiBufferSize - uiSlot;
+	UCHAR*	pvBuffer		= (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize;
+
+	// If the claimed slots wrap around the end of the buffer then we need to copy twice
+	if (uiLength > uiFirstLength)
+	{
+		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy((UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->pvBuffer, psRingBuffer->uiElementSize * (uiLength - uiFirstLength));
+	}
+	else
+	{
+		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiLength);
+	}
+}
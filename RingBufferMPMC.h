@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferMPMC.h
+// 	Brief 		: 	Lock-free multi-producer/multi-consumer ring buffer. Each element slot carries a
+//					sequence number and producers/consumers claim slots by CAS on the push/pop
+//					tickets, so no lock is taken by any thread
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Align with BUFFER_ALIGNED instead of _Alignas
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_MPMC_H_
+#define _RING_BUFFER_MPMC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdatomic.h>
+#include "TypeDef.h"
+#include "RingBufferConfig.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Multi-producer/multi-consumer ring buffer structure
+typedef struct S_RING_BUFFER_MPMC
+{
+	// Read-only after initialization
+	_Atomic UINT16*			puiSequence;				// Sequence number of each element slot
+	void*					pvBuffer;					// Data buffer
+	UINT16					uiBufferSize;				// Size of buffer or the total of elements
+	UINT16					uiBufferMask;				// uiBufferSize - 1, used to wrap the tickets
+	UINT16					uiElementSize;				// Size of each element of the buffer in byte
+
+	// Shared by the producers
+	BUFFER_ALIGNED
+	_Atomic UINT16			uiBufferPushPtr;			// Ticket of the next element to be pushed
+
+	// Shared by the consumers
+	BUFFER_ALIGNED
+	_Atomic UINT16			uiBufferPopPtr;				// Ticket of the next element to be popped
+
+} SRingBufferMPMC;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Size in byte of the storage area needed by BufferMPMCInit: the slot sequence numbers followed by
+// the element data
+#define BUFFER_MPMC_STORAGE_SIZE(uiBufferSize, uiElementSize)	\
+			((uiBufferSize) * (sizeof(_Atomic UINT16) + (uiElementSize)))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferMPMCInit(SRingBufferMPMC* psRingBuffer,
+							   void* pvStorage,
+							   UINT16 uiBufferSize,
+							   UINT16 uiElementSize);
+
+BOOL 			BufferMPMCPushStream(SRingBufferMPMC* psRingBuffer, void* pvStream, UINT16 uiLength);
+UINT16 			BufferMPMCPopStream(SRingBufferMPMC* psRingBuffer, void* pvStream, UINT16 uiLength);
+BOOL 			BufferMPMCPush(SRingBufferMPMC* psRingBuffer, void* pvData);
+UINT16			BufferMPMCPop(SRingBufferMPMC* psRingBuffer, void* pvData);
+UINT16			BufferMPMCGetCount(SRingBufferMPMC* psRingBuffer);
+UINT16			BufferMPMCGetAvailableCount(SRingBufferMPMC* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_MPMC_H_
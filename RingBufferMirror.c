@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferMirror.c
+// 	Brief 		: 	Mirrored data buffer for the ring buffer. The storage is mapped twice, back to back,
+//					in virtual memory so that any run of up to uiBufferSize elements starting at any
+//					index is one contiguous address range
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (memfd_create and mmap)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#ifndef _GNU_SOURCE
+	#define _GNU_SOURCE
+#endif
+#include <sys/mman.h>
+#include <unistd.h>
+#include "RingBufferMirror.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a ring buffer on a mirrored data buffer. Stream pushing and popping then
+//				always take a single copy, and BufferReserve/BufferPeek always return a single span
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	:	uiBufferSize is the length of buffer or the number of elements in the buffer
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@param	:	callbackLock is the call-back function for locking multi-access
+//	@param	:	callbackUnlock is the call-back function for unlocking multi-access
+//	@param	:	pvCallbackParam is the parameter of the call-back functions
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	uiBufferSize * uiElementSize must be a multiple of the page size. The data buffer is
+//				allocated here and must be released by BufferDeinitMirrored
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferInitMirrored(SRingBuffer* psRingBuffer,
+						BUFFER_INDEX uiBufferSize,
+						UINT16 uiElementSize,
+						CallbackFunction1I0O callbackLock,
+						CallbackFunction1I0O callbackUnlock,
+						void* pvCallbackParam)
+{
+	size_t	szBytes		= (size_t)uiBufferSize * uiElementSize;
+	long	lPageSize	= sysconf(_SC_PAGESIZE);
+	int		iFd			= -1;
+	UCHAR*	pvBuffer	= MAP_FAILED;
+	BOOL	bResult		= FALSE;
+
+	// Both mappings must start on a page boundary
+	if ((szBytes == 0) || (lPageSize <= 0) || ((szBytes % (size_t)lPageSize) != 0))
+	{
+		return FALSE;
+	}
+
+	iFd = memfd_create("RingBuffer", MFD_CLOEXEC);
+	if (iFd < 0)
+	{
+		return FALSE;
+	}
+
+	if (ftruncate(iFd, (off_t)szBytes) == 0)
+	{
+		// Reserve an address range for both copies, then map the storage over each half of it
+		pvBuffer = mmap(NULL, 2 * szBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	}
+
+	if (pvBuffer != MAP_FAILED)
+	{
+		if ((mmap(pvBuffer, szBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) != MAP_FAILED) &&
+			(mmap(pvBuffer + szBytes, szBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, iFd, 0) != MAP_FAILED))
+		{
+			BufferInit(psRingBuffer, pvBuffer, uiBufferSize, uiElementSize, callbackLock, callbackUnlock, pvCallbackParam);
+			psRingBuffer->bBufferMirrored = TRUE;
+			bResult = TRUE;
+		}
+		else
+		{
+			munmap(pvBuffer, 2 * szBytes);
+		}
+	}
+
+	// The mappings keep the storage alive, the descriptor is no longer needed
+	close(iFd);
+
+	return bResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the mirrored data buffer of a ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer initialized by BufferInitMirrored
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+void BufferDeinitMirrored(SRingBuffer* psRingBuffer)
+{
+	if (psRingBuffer->bBufferMirrored == FALSE)
+	{
+		return;
+	}
+
+	munmap(psRingBuffer->pvBuffer, 2 * (size_t)psRingBuffer->uiBufferSize * psRingBuffer->uiElementSize);
+
+	psRingBuffer->pvBuffer			= NULL;
+	psRingBuffer->bBufferMirrored	= FALSE;
+}
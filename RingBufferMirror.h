@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferMirror.h
+// 	Brief 		: 	Mirrored data buffer for the ring buffer. The storage is mapped twice, back to back,
+//					in virtual memory so that any run of up to uiBufferSize elements starting at any
+//					index is one contiguous address range
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (memfd_create and mmap)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_MIRROR_H_
+#define _RING_BUFFER_MIRROR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferInitMirrored(SRingBuffer* psRingBuffer,
+								   BUFFER_INDEX uiBufferSize,
+								   UINT16 uiElementSize,
+								   CallbackFunction1I0O callbackLock,
+								   CallbackFunction1I0O callbackUnlock,
+								   void* pvCallbackParam);
+
+void			BufferDeinitMirrored(SRingBuffer* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_MIRROR_H_
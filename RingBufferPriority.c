@@ -0,0 +1,365 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferPriority.c
+// 	Brief 		: 	Prioritized ring buffer made of several lanes, each one an SRingBuffer. The producers
+//					push into the lane of their priority and the consumers pop in the order of a
+//					scheduler: strict priority with aging, or weighted round-robin. A control message
+//					no longer waits behind the bulk data already queued
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <string.h>
+#include "RingBufferPriority.h"
+
+#if (RING_BUFFER_ENABLE_LOCKS != 1)
+	#error "RingBufferPriority.c requires RING_BUFFER_ENABLE_LOCKS to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// No lane holds elements
+#define PRIORITY_NO_LANE					0xFFFF
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Ring buffer of a lane
+#define PRIORITY_RING(ps, uiLane)			(&(ps)->asLane[(uiLane)].sRingBuffer)
+
+// Take or release the scheduler lock, if there is one
+#define PRIORITY_LOCK(ps)					do { if ((ps)->sLock.uiPolicy != BUFFER_LOCK_CALLBACK) { BufferLockAcquire(&(ps)->sLock); } } while (0)
+#define PRIORITY_UNLOCK(ps)					do { if ((ps)->sLock.uiPolicy != BUFFER_LOCK_CALLBACK) { BufferLockRelease(&(ps)->sLock); } } while (0)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static UINT16	BufferPrioritySelectStrict(SRingBufferPriority* psPriority);
+static UINT16	BufferPrioritySelectWeighted(SRingBufferPriority* psPriority);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a prioritized ring buffer
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	:	uiLaneCount is the number of lanes, up to RING_BUFFER_PRIORITY_LANES
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@param	:	uiScheduler is the dequeue order, BUFFER_PRIORITY_STRICT or BUFFER_PRIORITY_WEIGHTED
+//	@param	:	uiMaxWait is the number of pops a lane holding elements can be passed over by the
+//				strict scheduler before it is served, 0 for pure strict priority. A lane is then
+//				served within uiMaxWait + uiLaneCount pops
+//	@param	:	uiLockPolicy is the lock of the lanes and of the scheduler (BUFFER_LOCK_xxx),
+//				BUFFER_LOCK_CALLBACK for a single thread
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	Every lane must then be initialized by BufferPriorityInitLane
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferPriorityInit(SRingBufferPriority* psPriority,
+						UINT16 uiLaneCount,
+						UINT16 uiElementSize,
+						BUFFER_PRIORITY_SCHEDULER uiScheduler,
+						UINT32 uiMaxWait,
+						BUFFER_LOCK_POLICY uiLockPolicy)
+{
+	if ((uiLaneCount == 0) || (uiLaneCount > RING_BUFFER_PRIORITY_LANES) || 
+		((uiScheduler != BUFFER_PRIORITY_STRICT) && (uiScheduler != BUFFER_PRIORITY_WEIGHTED)))
+	{
+		return FALSE;
+	}
+
+	// A lane not initialized yet has no room and no element
+	memset(psPriority->asLane, 0, sizeof(psPriority->asLane));
+
+	psPriority->uiLaneCount		= uiLaneCount;
+	psPriority->uiElementSize	= uiElementSize;
+	psPriority->uiScheduler		= uiScheduler;
+	psPriority->uiMaxWait		= uiMaxWait;
+	psPriority->uiCurrentLane	= 0;
+	psPriority->uiCredit		= 0;
+
+	return BufferLockCreate(&psPriority->sLock, uiLockPolicy);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a lane of a prioritized ring buffer
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	:	uiLane is the lane, 0 is the highest priority
+//	@param	: 	pvBuffer is the data storage area of the lane
+//	@param	:	uiBufferSize is the number of elements of the lane
+//	@param	:	uiWeight is the number of elements the lane serves in a row under the weighted
+//				round-robin, at least 1. Not used by the strict scheduler
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	Before any push or pop
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferPriorityInitLane(SRingBufferPriority* psPriority,
+							UINT16 uiLane,
+							void* pvBuffer,
+							BUFFER_INDEX uiBufferSize,
+							UINT16 uiWeight)
+{
+	SBufferPriorityLane*	psLane	= &psPriority->asLane[uiLane];
+
+	if ((uiLane >= psPriority->uiLaneCount) || (uiBufferSize == 0) || (uiWeight == 0))
+	{
+		return FALSE;
+	}
+
+	psLane->uiWeight	= uiWeight;
+	psLane->uiWaitPops	= 0;
+
+	if (uiLane == psPriority->uiCurrentLane)
+	{
+		psPriority->uiCredit = uiWeight;
+	}
+
+	return BufferInitWithLock(&psLane->sRingBuffer, pvBuffer, uiBufferSize, psPriority->uiElementSize, psPriority->sLock.uiPolicy);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the locks of a prioritized ring buffer
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer, not used by any other thread
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+void BufferPriorityDeinit(SRingBufferPriority* psPriority)
+{
+	UINT16	uiLane	= 0;
+
+	for (uiLane = 0; uiLane < psPriority->uiLaneCount; uiLane++)
+	{
+		if (PRIORITY_RING(psPriority, uiLane)->uiBufferSize != 0)
+		{
+			BufferDeinit(PRIORITY_RING(psPriority, uiLane));
+		}
+	}
+
+	BufferLockDestroy(&psPriority->sLock);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into a lane
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	:	uiLane is the lane, 0 is the highest priority
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	The producers take the lock of their lane only, not the scheduler lock
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferPriorityPushStream(SRingBufferPriority* psPriority, UINT16 uiLane, void* pvStream, BUFFER_INDEX uiLength)
+{
+	if (uiLane >= psPriority->uiLaneCount)
+	{
+		return FALSE;
+	}
+
+	return BufferPushStream(PRIORITY_RING(psPriority, uiLane), pvStream, uiLength);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from the lane selected by the scheduler
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@param	:	puiLane receives the lane the elements come from, may be NULL
+//	@return	: 	The number of elements popped out actually
+//	@note	:	The elements of a stream come from one lane. Under the weighted round-robin a stream
+//				is also limited to the elements the lane may still serve in a row
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPriorityPopStream(SRingBufferPriority* psPriority, void* pvStream, BUFFER_INDEX uiLength, UINT16* puiLane)
+{
+	UINT16			uiLane		= PRIORITY_NO_LANE;
+	BUFFER_INDEX	uiPopCount	= 0;
+
+	PRIORITY_LOCK(psPriority);
+
+	if (psPriority->uiScheduler == BUFFER_PRIORITY_WEIGHTED)
+	{
+		uiLane = BufferPrioritySelectWeighted(psPriority);
+		if (uiLane != PRIORITY_NO_LANE)
+		{
+			if (uiLength > psPriority->uiCredit)
+			{
+				uiLength = psPriority->uiCredit;
+			}
+			uiPopCount				= BufferPopStream(PRIORITY_RING(psPriority, uiLane), pvStream, uiLength);
+			psPriority->uiCredit	-= uiPopCount;
+		}
+	}
+	else
+	{
+		uiLane = BufferPrioritySelectStrict(psPriority);
+		if (uiLane != PRIORITY_NO_LANE)
+		{
+			uiPopCount = BufferPopStream(PRIORITY_RING(psPriority, uiLane), pvStream, uiLength);
+		}
+	}
+
+	PRIORITY_UNLOCK(psPriority);
+
+	if ((uiPopCount > 0) && (puiLane != NULL))
+	{
+		*puiLane = uiLane;
+	}
+
+	return uiPopCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into a lane
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	:	uiLane is the lane, 0 is the highest priority
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferPriorityPush(SRingBufferPriority* psPriority, UINT16 uiLane, void* pvData)
+{
+	return BufferPriorityPushStream(psPriority, uiLane, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from the lane selected by the scheduler
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@param	:	puiLane receives the lane the element comes from, may be NULL
+//	@return	: 	The number of elements popped out actually
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPriorityPop(SRingBufferPriority* psPriority, void* pvData, UINT16* puiLane)
+{
+	return BufferPriorityPopStream(psPriority, pvData, 1, puiLane);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of a lane
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	:	uiLane is the lane
+//	@return	: 	Element count of the lane
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPriorityGetCount(SRingBufferPriority* psPriority, UINT16 uiLane)
+{
+	return (uiLane < psPriority->uiLaneCount) ? BufferGetCount(PRIORITY_RING(psPriority, uiLane)) : 0;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the available (free) element count of a lane
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@param	:	uiLane is the lane
+//	@return	: 	Available element count of the lane
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPriorityGetAvailableCount(SRingBufferPriority* psPriority, UINT16 uiLane)
+{
+	return (uiLane < psPriority->uiLaneCount) ? BufferGetAvailableCount(PRIORITY_RING(psPriority, uiLane)) : 0;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of all lanes together
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer
+//	@return	: 	Element count
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferPriorityGetTotalCount(SRingBufferPriority* psPriority)
+{
+	UINT64	uiCount	= 0;
+	UINT16	uiLane	= 0;
+
+	for (uiLane = 0; uiLane < psPriority->uiLaneCount; uiLane++)
+	{
+		uiCount += BufferGetCount(PRIORITY_RING(psPriority, uiLane));
+	}
+
+	return uiCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Select the lane to pop under the strict scheduler
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer, locked
+//	@return	: 	The lane, or PRIORITY_NO_LANE if they are all empty
+//	@note	:	The highest lane holding elements, unless a lower one has been passed over uiMaxWait
+//				pops in a row. Every other lane holding elements ages by one pop
+// ---------------------------------------------------------------------------------------------------
+static UINT16 BufferPrioritySelectStrict(SRingBufferPriority* psPriority)
+{
+	UINT16					uiSelected	= PRIORITY_NO_LANE;
+	UINT16					uiLane		= 0;
+	SBufferPriorityLane*	psLane		= NULL;
+
+	for (uiLane = 0; uiLane < psPriority->uiLaneCount; uiLane++)
+	{
+		psLane = &psPriority->asLane[uiLane];
+		if (BufferGetCount(&psLane->sRingBuffer) == 0)
+		{
+			continue;
+		}
+
+		if (uiSelected == PRIORITY_NO_LANE)
+		{
+			uiSelected = uiLane;
+		}
+		else if ((psPriority->uiMaxWait != 0) && (psLane->uiWaitPops >= psPriority->uiMaxWait) &&
+				 (psPriority->asLane[uiSelected].uiWaitPops < psPriority->uiMaxWait))
+		{
+			// The highest starving lane goes before the lanes above it
+			uiSelected = uiLane;
+		}
+	}
+
+	for (uiLane = 0; uiLane < psPriority->uiLaneCount; uiLane++)
+	{
+		psLane = &psPriority->asLane[uiLane];
+		if ((uiLane == uiSelected) || (BufferGetCount(&psLane->sRingBuffer) == 0))
+		{
+			psLane->uiWaitPops = 0;
+		}
+		else
+		{
+			psLane->uiWaitPops++;
+		}
+	}
+
+	return uiSelected;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Select the lane to pop under the weighted round-robin
+//
+//	@param	: 	psPriority is the structure of the prioritized ring buffer, locked
+//	@return	: 	The lane, or PRIORITY_NO_LANE if they are all empty
+//	@note	:	The current lane is served until it has used its weight or it is empty, then the next
+//				lane holding elements gets a full weight. An empty lane gives up the rest of its turn
+// ---------------------------------------------------------------------------------------------------
+static UINT16 BufferPrioritySelectWeighted(SRingBufferPriority* psPriority)
+{
+	UINT16	uiStep	= 0;
+
+	for (uiStep = 0; uiStep <= psPriority->uiLaneCount; uiStep++)
+	{
+		if ((psPriority->uiCredit > 0) && (BufferGetCount(PRIORITY_RING(psPriority, psPriority->uiCurrentLane)) > 0))
+		{
+			return psPriority->uiCurrentLane;
+		}
+
+		psPriority->uiCurrentLane	= (psPriority->uiCurrentLane + 1) % psPriority->uiLaneCount;
+		psPriority->uiCredit		= psPriority->asLane[psPriority->uiCurrentLane].uiWeight;
+	}
+
+	return PRIORITY_NO_LANE;
+}
@@ -0,0 +1,91 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferPriority.h
+// 	Brief 		: 	Prioritized ring buffer made of several lanes, each one an SRingBuffer. The producers
+//					push into the lane of their priority and the consumers pop in the order of a
+//					scheduler: strict priority with aging, or weighted round-robin. A control message
+//					no longer waits behind the bulk data already queued
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_PRIORITY_H_
+#define _RING_BUFFER_PRIORITY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Schedulers of BufferPriorityInit
+#define BUFFER_PRIORITY_STRICT		0		// Lane 0 first, then lane 1... A lane passed over uiMaxWait pops in a row is served next
+#define BUFFER_PRIORITY_WEIGHTED	1		// Round-robin, each lane serves up to its weight of elements in a row
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Scheduler, one of BUFFER_PRIORITY_xxx
+typedef UINT16				BUFFER_PRIORITY_SCHEDULER;
+
+// Lane of a prioritized ring buffer
+typedef struct S_BUFFER_PRIORITY_LANE
+{
+	SRingBuffer				sRingBuffer;				// The ring buffer of the lane
+	UINT16					uiWeight;					// Elements served in a row (weighted round-robin)
+	UINT32					uiWaitPops;					// Pops which passed over the lane while it held elements (strict)
+
+} SBufferPriorityLane;
+
+// Prioritized ring buffer
+typedef struct S_RING_BUFFER_PRIORITY
+{
+	UINT16					uiLaneCount;				// Number of lanes, lane 0 has the highest priority
+	UINT16					uiElementSize;				// Size in byte of each element of every lane
+	BUFFER_PRIORITY_SCHEDULER uiScheduler;				// Dequeue order
+	UINT32					uiMaxWait;					// Aging limit of the strict scheduler, 0 for none
+	UINT16					uiCurrentLane;				// Lane being served (weighted round-robin)
+	UINT16					uiCredit;					// Elements the current lane may still serve in a row
+	SBufferLock				sLock;						// Serializes the consumers through the scheduler
+	SBufferPriorityLane		asLane[RING_BUFFER_PRIORITY_LANES];	// The lanes
+
+} SRingBufferPriority;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferPriorityInit(SRingBufferPriority* psPriority,
+								   UINT16 uiLaneCount,
+								   UINT16 uiElementSize,
+								   BUFFER_PRIORITY_SCHEDULER uiScheduler,
+								   UINT32 uiMaxWait,
+								   BUFFER_LOCK_POLICY uiLockPolicy);
+BOOL			BufferPriorityInitLane(SRingBufferPriority* psPriority,
+									   UINT16 uiLane,
+									   void* pvBuffer,
+									   BUFFER_INDEX uiBufferSize,
+									   UINT16 uiWeight);
+void			BufferPriorityDeinit(SRingBufferPriority* psPriority);
+
+BOOL 			BufferPriorityPushStream(SRingBufferPriority* psPriority, UINT16 uiLane, void* pvStream, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferPriorityPopStream(SRingBufferPriority* psPriority, void* pvStream, BUFFER_INDEX uiLength, UINT16* puiLane);
+BOOL 			BufferPriorityPush(SRingBufferPriority* psPriority, UINT16 uiLane, void* pvData);
+BUFFER_INDEX	BufferPriorityPop(SRingBufferPriority* psPriority, void* pvData, UINT16* puiLane);
+BUFFER_INDEX	BufferPriorityGetCount(SRingBufferPriority* psPriority, UINT16 uiLane);
+BUFFER_INDEX	BufferPriorityGetAvailableCount(SRingBufferPriority* psPriority, UINT16 uiLane);
+UINT64			BufferPriorityGetTotalCount(SRingBufferPriority* psPriority);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_PRIORITY_H_
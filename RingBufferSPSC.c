@@ -0,0 +1,259 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferSPSC.c
+// 	Brief 		: 	Lock-free single-producer/single-consumer ring buffer. The push side owns only the
+//					push pointer and the pop side owns only the pop pointer, so no lock is needed
+//					when exactly one thread pushes and exactly one thread pops
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <string.h>
+#include "RingBufferSPSC.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Number of elements between the pop pointer and the push pointer
+#define SPSC_DISTANCE(ps, uiPush, uiPop)	(((uiPush) >= (uiPop)) ? ((uiPush) - (uiPop)) : ((uiPush) + 2 * (ps)->uiBufferSize - (uiPop)))
+
+// Index of the element in the data buffer which a push or pop pointer refers to
+#define SPSC_SLOT(ps, uiPtr)				(((uiPtr) >= (ps)->uiBufferSize) ? ((uiPtr) - (ps)->uiBufferSize) : (uiPtr))
+
+// Move a push or pop pointer forward by uiLength elements
+#define SPSC_ADVANCE(ps, uiPtr, uiLength)	do { (uiPtr) += (uiLength); if ((uiPtr) >= 2 * (ps)->uiBufferSize) { (uiPtr) -= 2 * (ps)->uiBufferSize; } } while (0)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a single-producer/single-consumer ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvBuffer is the data storage area
+//	@param	:	uiBufferSize is the length of buffer or the number of elements in the buffer. It must
+//				not be greater than a half of the maximum value of UINT16
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@return	: 	Void
+//	@note	:	Must be called before the producer and the consumer threads are started
+// ---------------------------------------------------------------------------------------------------
+void BufferSPSCInit(SRingBufferSPSC* psRingBuffer,
+					void* pvBuffer,
+					UINT16 uiBufferSize,
+					UINT16 uiElementSize)
+{
+	// Initialize data for the Ring buffer structure
+	psRingBuffer->pvBuffer			= pvBuffer;
+	psRingBuffer->uiBufferSize		= uiBufferSize;
+	psRingBuffer->uiElementSize		= uiElementSize;
+
+	atomic_init(&psRingBuffer->uiBufferPushPtr, 0);
+	atomic_init(&psRingBuffer->uiBufferPopPtr, 0);
+	psRingBuffer->uiCachedPopPtr	= 0;
+	psRingBuffer->uiCachedPushPtr	= 0;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	Must be called from the push side only
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferSPSCPushStream(SRingBufferSPSC* psRingBuffer, void* pvStream, UINT16 uiLength)
+{
+	UINT16	uiPushPtr		= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+	UINT16	uiSlot			= SPSC_SLOT(psRingBuffer, uiPushPtr);
+	UINT16	uiFirstLength	= 0;
+	UCHAR*	pvBuffer		= NULL;
+
+	// Only reload the pop pointer of the other side when the cached one says there is not enough room
+	if ((SPSC_DISTANCE(psRingBuffer, uiPushPtr, psRingBuffer->uiCachedPopPtr) + uiLength) > psRingBuffer->uiBufferSize)
+	{
+		psRingBuffer->uiCachedPopPtr = atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_acquire);
+		if ((SPSC_DISTANCE(psRingBuffer, uiPushPtr, psRingBuffer->uiCachedPopPtr) + uiLength) > psRingBuffer->uiBufferSize)
+		{
+			return FALSE;
+		}
+	}
+
+	// Calculate the start address for pushing in
+	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize;
+
+	// If the pushing address is out of address range of the buffer then we need to push twice
+	if ((uiSlot + uiLength) > psRingBuffer->uiBufferSize)
+	{
+		uiFirstLength = psRingBuffer->uiBufferSize - uiSlot;
+		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy(psRingBuffer->pvBuffer, (UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->uiElementSize * (uiLength - uiFirstLength));
+	}
+	else
+	{
+		memcpy(pvBuffer, pvStream, psRingBuffer->uiElementSize * uiLength);
+	}
+
+	// Publish the new elements to the pop side
+	SPSC_ADVANCE(psRingBuffer, uiPushPtr, uiLength);
+	atomic_store_explicit(&psRingBuffer->uiBufferPushPtr, uiPushPtr, memory_order_release);
+
+	return TRUE;	// Push successfully
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Must be called from the pop side only
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferSPSCPopStream(SRingBufferSPSC* psRingBuffer, void* pvStream, UINT16 uiLength)
+{
+	UINT16	uiPopPtr		= atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_relaxed);
+	UINT16	uiSlot			= SPSC_SLOT(psRingBuffer, uiPopPtr);
+	UINT16	uiPopCount		= SPSC_DISTANCE(psRingBuffer, psRingBuffer->uiCachedPushPtr, uiPopPtr);
+	UINT16	uiFirstLength	= 0;
+	UCHAR*	pvBuffer		= NULL;
+
+	// Only reload the push pointer of the other side when the cached one cannot satisfy the request
+	if (uiPopCount < uiLength)
+	{
+		psRingBuffer->uiCachedPushPtr = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+		uiPopCount = SPSC_DISTANCE(psRingBuffer, psRingBuffer->uiCachedPushPtr, uiPopPtr);
+		if (uiPopCount == 0)
+		{
+			return 0;
+		}
+	}
+
+	// Limit length of data stream will be popped
+	if (uiLength < uiPopCount)
+	{
+		uiPopCount = uiLength;
+	}
+
+	// Calculate the start address for popping out
+	pvBuffer = (UCHAR*)psRingBuffer->pvBuffer + uiSlot * psRingBuffer->uiElementSize;
+
+	// If the popping address is out of address range of the buffer then we need to pop twice
+	if ((uiSlot + uiPopCount) > psRingBuffer->uiBufferSize)
+	{
+		uiFirstLength = psRingBuffer->uiBufferSize - uiSlot;
+		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy((UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->pvBuffer, psRingBuffer->uiElementSize * (uiPopCount - uiFirstLength));
+	}
+	else
+	{
+		memcpy(pvStream, pvBuffer, psRingBuffer->uiElementSize * uiPopCount);
+	}
+
+	// Hand the freed elements back to the push side
+	SPSC_ADVANCE(psRingBuffer, uiPopPtr, uiPopCount);
+	atomic_store_explicit(&psRingBuffer->uiBufferPopPtr, uiPopPtr, memory_order_release);
+
+	return uiPopCount;	// Return the number of elements popped out actually
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	Must be called from the push side only
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferSPSCPush(SRingBufferSPSC* psRingBuffer, void* pvData)
+{
+	UINT16	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_relaxed);
+
+	if (SPSC_DISTANCE(psRingBuffer, uiPushPtr, psRingBuffer->uiCachedPopPtr) >= psRingBuffer->uiBufferSize)
+	{
+		psRingBuffer->uiCachedPopPtr = atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_acquire);
+		if (SPSC_DISTANCE(psRingBuffer, uiPushPtr, psRingBuffer->uiCachedPopPtr) >= psRingBuffer->uiBufferSize)
+		{
+			return FALSE;
+		}
+	}
+
+	// Push data element
+	memcpy((UCHAR*)psRingBuffer->pvBuffer + SPSC_SLOT(psRingBuffer, uiPushPtr) * psRingBuffer->uiElementSize, pvData, psRingBuffer->uiElementSize);
+
+	// Publish the new element to the pop side
+	SPSC_ADVANCE(psRingBuffer, uiPushPtr, 1);
+	atomic_store_explicit(&psRingBuffer->uiBufferPushPtr, uiPushPtr, memory_order_release);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Must be called from the pop side only
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferSPSCPop(SRingBufferSPSC* psRingBuffer, void* pvData)
+{
+	UINT16	uiPopPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_relaxed);
+
+	if (uiPopPtr == psRingBuffer->uiCachedPushPtr)
+	{
+		psRingBuffer->uiCachedPushPtr = atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+		if (uiPopPtr == psRingBuffer->uiCachedPushPtr)
+		{
+			return 0;
+		}
+	}
+
+	// Pop data element
+	memcpy(pvData, (UCHAR*)psRingBuffer->pvBuffer + SPSC_SLOT(psRingBuffer, uiPopPtr) * psRingBuffer->uiElementSize, psRingBuffer->uiElementSize);
+
+	// Hand the freed element back to the push side
+	SPSC_ADVANCE(psRingBuffer, uiPopPtr, 1);
+	atomic_store_explicit(&psRingBuffer->uiBufferPopPtr, uiPopPtr, memory_order_release);
+
+	return 1;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of the buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Element count of the buffer
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferSPSCGetCount(SRingBufferSPSC* psRingBuffer)
+{
+	UINT16	uiPopPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPopPtr, memory_order_acquire);
+	UINT16	uiPushPtr	= atomic_load_explicit(&psRingBuffer->uiBufferPushPtr, memory_order_acquire);
+
+	return SPSC_DISTANCE(psRingBuffer, uiPushPtr, uiPopPtr);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the available (free or can be used for pushing) element count of the buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Available element count of the buffer
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferSPSCGetAvailableCount(SRingBufferSPSC* psRingBuffer)
+{
+	return psRingBuffer->uiBufferSize - BufferSPSCGetCount(psRingBuffer);
+}
@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferSPSC.h
+// 	Brief 		: 	Lock-free single-producer/single-consumer ring buffer. The push side owns only the
+//					push pointer and the pop side owns only the pop pointer, so no lock is needed
+//					when exactly one thread pushes and exactly one thread pops
+//	Author 		: 	AnhNH57
+//  Note 		: 	Requires a C11 compiler with <stdatomic.h>
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Align with BUFFER_ALIGNED instead of _Alignas
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_SPSC_H_
+#define _RING_BUFFER_SPSC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdatomic.h>
+#include "TypeDef.h"
+#include "RingBufferConfig.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Single-producer/single-consumer ring buffer structure.
+// The push and pop pointers run in the range [0, 2 * uiBufferSize) so that a full buffer and an empty
+// buffer can be told apart without an element count shared by both sides
+typedef struct S_RING_BUFFER_SPSC
+{
+	// Read-only after initialization
+	void*					pvBuffer;					// Data buffer
+	UINT16					uiBufferSize;				// Size of buffer or the total of elements
+	UINT16					uiElementSize;				// Size of each element of the buffer in byte
+
+	// Owned by the push side
+	BUFFER_ALIGNED
+	_Atomic UINT16			uiBufferPushPtr;			// The pointer to start writing
+	UINT16					uiCachedPopPtr;				// Last pop pointer seen by the push side
+
+	// Owned by the pop side
+	BUFFER_ALIGNED
+	_Atomic UINT16			uiBufferPopPtr;				// The pointer to start reading
+	UINT16					uiCachedPushPtr;			// Last push pointer seen by the pop side
+
+} SRingBufferSPSC;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+void			BufferSPSCInit(SRingBufferSPSC* psRingBuffer,
+							   void* pvBuffer,
+							   UINT16 uiBufferSize,
+							   UINT16 uiElementSize);
+
+BOOL 			BufferSPSCPushStream(SRingBufferSPSC* psRingBuffer, void* pvStream, UINT16 uiLength);
+UINT16 			BufferSPSCPopStream(SRingBufferSPSC* psRingBuffer, void* pvStream, UINT16 uiLength);
+BOOL 			BufferSPSCPush(SRingBufferSPSC* psRingBuffer, void* pvData);
+UINT16			BufferSPSCPop(SRingBufferSPSC* psRingBuffer, void* pvData);
+UINT16			BufferSPSCGetCount(SRingBufferSPSC* psRingBuffer);
+UINT16			BufferSPSCGetAvailableCount(SRingBufferSPSC* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_SPSC_H_
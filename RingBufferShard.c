@@ -0,0 +1,306 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferShard.c
+// 	Brief 		: 	Sharded ring buffer made of several SRingBuffer, one per producer or per CPU, so that
+//					the producers do not all write the same cache lines. Each consumer pops its home
+//					shard first and steals a batch from the other shards when it is empty
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (sched_getcpu). Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Move a batch into the home shard after a steal
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#ifndef _GNU_SOURCE
+	#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#include "RingBufferShard.h"
+
+#if (RING_BUFFER_ENABLE_LOCKS != 1)
+	#error "RingBufferShard.c requires RING_BUFFER_ENABLE_LOCKS to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Ring buffer of a shard
+#define SHARD_RING(ps, uiShard)				(&(ps)->asShard[(uiShard)].sRingBuffer)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static UINT16	BufferShardHome(SRingBufferShard* psShard, UINT16 uiNumber);
+static void		BufferShardMigrate(SRingBufferShard* psShard, UINT16 uiVictim, UINT16 uiHome);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Initialize a sharded ring buffer
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@param	: 	pvBuffer is the data storage area of uiShardCount * uiShardSize elements, split
+//				between the shards
+//	@param	:	uiShardCount is the number of shards, up to RING_BUFFER_SHARD_MAX. One per producer
+//				thread or one per CPU
+//	@param	:	uiShardSize is the number of elements of each shard
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@param	:	uiLockPolicy is the lock of each shard (BUFFER_LOCK_xxx)
+//	@param	:	bProducerFifo is TRUE to keep the order of the elements of each producer: a producer
+//				pushes into its own shard only, and fails when it is full. FALSE lets a push go to the
+//				next shards when the home one is full
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShardInit(SRingBufferShard* psShard,
+					 void* pvBuffer,
+					 UINT16 uiShardCount,
+					 BUFFER_INDEX uiShardSize,
+					 UINT16 uiElementSize,
+					 BUFFER_LOCK_POLICY uiLockPolicy,
+					 BOOL bProducerFifo)
+{
+	UINT16	uiShard	= 0;
+
+	if ((uiShardCount == 0) || (uiShardCount > RING_BUFFER_SHARD_MAX))
+	{
+		return FALSE;
+	}
+
+	for (uiShard = 0; uiShard < uiShardCount; uiShard++)
+	{
+		if (BufferInitWithLock(SHARD_RING(psShard, uiShard), 
+							   (UCHAR*)pvBuffer + (size_t)uiShard * uiShardSize * uiElementSize, 
+							   uiShardSize, 
+							   uiElementSize, 
+							   uiLockPolicy) == FALSE)
+		{
+			while (uiShard > 0)
+			{
+				uiShard--;
+				BufferDeinit(SHARD_RING(psShard, uiShard));
+			}
+			return FALSE;
+		}
+
+		psShard->asShard[uiShard].uiStealHint = (uiShard + 1) % uiShardCount;
+	}
+
+	psShard->uiShardCount	= uiShardCount;
+	psShard->bProducerFifo	= bProducerFifo;
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Release the locks of a sharded ring buffer
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer, not used by any other thread
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+void BufferShardDeinit(SRingBufferShard* psShard)
+{
+	UINT16	uiShard	= 0;
+
+	for (uiShard = 0; uiShard < psShard->uiShardCount; uiShard++)
+	{
+		BufferDeinit(SHARD_RING(psShard, uiShard));
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into the shard of a producer
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@param	: 	uiProducer is the number of the producer, or BUFFER_SHARD_CPU for the shard of the
+//				current CPU
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	The order of the elements of a producer is kept only with bProducerFifo and a fixed
+//				producer number, a thread may move to another CPU between two pushes
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShardPushStream(SRingBufferShard* psShard, UINT16 uiProducer, void* pvStream, BUFFER_INDEX uiLength)
+{
+	UINT16	uiHome		= BufferShardHome(psShard, uiProducer);
+	UINT16	uiStep		= 0;
+	BOOL	bResult		= FALSE;
+
+	bResult = BufferPushStream(SHARD_RING(psShard, uiHome), pvStream, uiLength);
+	if ((bResult == TRUE) || (psShard->bProducerFifo == TRUE))
+	{
+		return bResult;
+	}
+
+	// The home shard is full, any other shard will do
+	for (uiStep = 1; uiStep < psShard->uiShardCount; uiStep++)
+	{
+		if (BufferPushStream(SHARD_RING(psShard, (uiHome + uiStep) % psShard->uiShardCount), pvStream, uiLength) == TRUE)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from the home shard of a consumer, or steal it from another shard
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@param	: 	uiConsumer is the number of the consumer, or BUFFER_SHARD_CPU for the shard of the
+//				current CPU
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	A steal takes up to uiLength elements from one shard under a single lock, starting
+//				with the shard stolen from last. Without bProducerFifo it also moves half of the rest
+//				of that shard into the home one, so that the next pops are local instead of taking a
+//				remote lock for each element. With bProducerFifo the elements of a producer must stay
+//				in its shard, so the batch is the uiLength of the caller. The elements of a stream 
+//				come from one shard only
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferShardPopStream(SRingBufferShard* psShard, UINT16 uiConsumer, void* pvStream, BUFFER_INDEX uiLength)
+{
+	UINT16			uiHome		= BufferShardHome(psShard, uiConsumer);
+	UINT16			uiVictim	= 0;
+	UINT16			uiStep		= 0;
+	BUFFER_INDEX	uiPopCount	= 0;
+
+	uiPopCount = BufferPopStream(SHARD_RING(psShard, uiHome), pvStream, uiLength);
+	if (uiPopCount > 0)
+	{
+		return uiPopCount;
+	}
+
+	// An empty shard is rejected without taking its lock, so scanning them is cheap
+	uiVictim = __atomic_load_n(&psShard->asShard[uiHome].uiStealHint, __ATOMIC_RELAXED);
+	for (uiStep = 0; uiStep < psShard->uiShardCount; uiStep++)
+	{
+		if (uiVictim != uiHome)
+		{
+			uiPopCount = BufferPopStream(SHARD_RING(psShard, uiVictim), pvStream, uiLength);
+			if (uiPopCount > 0)
+			{
+				__atomic_store_n(&psShard->asShard[uiHome].uiStealHint, uiVictim, __ATOMIC_RELAXED);
+				if (psShard->bProducerFifo == FALSE)
+				{
+					BufferShardMigrate(psShard, uiVictim, uiHome);
+				}
+				return uiPopCount;
+			}
+		}
+
+		uiVictim = (uiVictim + 1) % psShard->uiShardCount;
+	}
+
+	return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into the shard of a producer
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@param	: 	uiProducer is the number of the producer, or BUFFER_SHARD_CPU
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShardPush(SRingBufferShard* psShard, UINT16 uiProducer, void* pvData)
+{
+	return BufferShardPushStream(psShard, uiProducer, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from the home shard of a consumer, or from another shard
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@param	: 	uiConsumer is the number of the consumer, or BUFFER_SHARD_CPU
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferShardPop(SRingBufferShard* psShard, UINT16 uiConsumer, void* pvData)
+{
+	return BufferShardPopStream(psShard, uiConsumer, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of all shards together
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@return	: 	Element count
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferShardGetCount(SRingBufferShard* psShard)
+{
+	UINT64	uiCount	= 0;
+	UINT16	uiShard	= 0;
+
+	for (uiShard = 0; uiShard < psShard->uiShardCount; uiShard++)
+	{
+		uiCount += BufferGetCount(SHARD_RING(psShard, uiShard));
+	}
+
+	return uiCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the home shard of a producer or a consumer
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@param	: 	uiNumber is the number of the producer or the consumer, or BUFFER_SHARD_CPU
+//	@return	: 	Number of the shard
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static UINT16 BufferShardHome(SRingBufferShard* psShard, UINT16 uiNumber)
+{
+	int		iCpu	= 0;
+
+	if (uiNumber == BUFFER_SHARD_CPU)
+	{
+		iCpu = sched_getcpu();
+		return (iCpu < 0) ? 0 : (UINT16)(iCpu % psShard->uiShardCount);
+	}
+
+	return uiNumber % psShard->uiShardCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Move half of the elements of a shard into another one
+//
+//	@param	: 	psShard is the structure of the sharded ring buffer
+//	@param	: 	uiVictim is the shard the elements are taken from
+//	@param	: 	uiHome is the shard receiving them
+//	@return	: 	Void
+//	@note	:	The elements are popped straight into a region reserved in uiHome, so nothing is 
+//				copied twice. Nothing is moved if uiHome has no room for the batch
+// ---------------------------------------------------------------------------------------------------
+static void BufferShardMigrate(SRingBufferShard* psShard, UINT16 uiVictim, UINT16 uiHome)
+{
+	SBufferSpan		asSpan[BUFFER_SPAN_COUNT];
+	BUFFER_INDEX	uiBatch		= BufferGetCount(SHARD_RING(psShard, uiVictim)) / 2;
+	BUFFER_INDEX	uiMoved		= 0;
+
+	if ((uiBatch == 0) || (BufferReserve(SHARD_RING(psShard, uiHome), uiBatch, asSpan) == FALSE))
+	{
+		return;
+	}
+
+	// Another consumer of the victim may take some of the elements meanwhile
+	uiMoved = BufferPopStream(SHARD_RING(psShard, uiVictim), asSpan[0].pvData, asSpan[0].uiLength);
+	if ((uiMoved == asSpan[0].uiLength) && (asSpan[1].uiLength > 0))
+	{
+		uiMoved += BufferPopStream(SHARD_RING(psShard, uiVictim), asSpan[1].pvData, asSpan[1].uiLength);
+	}
+
+	BufferCommit(SHARD_RING(psShard, uiHome), uiMoved);
+}
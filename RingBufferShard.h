@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferShard.h
+// 	Brief 		: 	Sharded ring buffer made of several SRingBuffer, one per producer or per CPU, so that
+//					the producers do not all write the same cache lines. Each consumer pops its home
+//					shard first and steals a batch from the other shards when it is empty
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (sched_getcpu). Requires RING_BUFFER_ENABLE_LOCKS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Align with BUFFER_ALIGNED instead of _Alignas
+// 	1.02  	AnhNH57  	17-10-2026 	Put the steal hint on its own cache line
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_SHARD_H_
+#define _RING_BUFFER_SHARD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Producer number selecting the shard of the CPU the caller runs on
+#define BUFFER_SHARD_CPU			0xFFFF
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// One shard, on its own cache lines
+typedef struct S_BUFFER_SHARD
+{
+	BUFFER_ALIGNED
+	SRingBuffer				sRingBuffer;				// The ring buffer of the shard
+	BUFFER_ALIGNED
+	UINT16					uiStealHint;				// Shard the consumers of this one stole from last
+
+} SBufferShard;
+
+// Sharded ring buffer
+typedef struct S_RING_BUFFER_SHARD
+{
+	UINT16					uiShardCount;				// Number of shards
+	BOOL					bProducerFifo;				// Each producer pushes into its own shard only
+	SBufferShard			asShard[RING_BUFFER_SHARD_MAX];	// The shards
+
+} SRingBufferShard;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferShardInit(SRingBufferShard* psShard,
+								void* pvBuffer,
+								UINT16 uiShardCount,
+								BUFFER_INDEX uiShardSize,
+								UINT16 uiElementSize,
+								BUFFER_LOCK_POLICY uiLockPolicy,
+								BOOL bProducerFifo);
+void			BufferShardDeinit(SRingBufferShard* psShard);
+
+BOOL 			BufferShardPushStream(SRingBufferShard* psShard, UINT16 uiProducer, void* pvStream, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferShardPopStream(SRingBufferShard* psShard, UINT16 uiConsumer, void* pvStream, BUFFER_INDEX uiLength);
+BOOL 			BufferShardPush(SRingBufferShard* psShard, UINT16 uiProducer, void* pvData);
+BUFFER_INDEX	BufferShardPop(SRingBufferShard* psShard, UINT16 uiConsumer, void* pvData);
+UINT64			BufferShardGetCount(SRingBufferShard* psShard);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_SHARD_H_
@@ -0,0 +1,403 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferShm.c
+// 	Brief 		: 	Single-producer/single-consumer ring buffer shared between processes. The header and
+//					the data area live in one POSIX shared memory segment and refer to each other by
+//					offsets only, so every process can map the segment at its own address
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (shm_open and mmap)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Build the view from the validated geometry, not from the header again
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "RingBufferShm.h"
+
+// The pointers are shared by processes which map them at different addresses: only lock-free atomics
+// are address-free
+#if (ATOMIC_LLONG_LOCK_FREE != 2) || (ATOMIC_LONG_LOCK_FREE != 2)
+	#error "RingBufferShm.c requires lock-free 64-bit atomics"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Address of the element in the data area which a push or pop pointer refers to
+#define SHM_SLOT(ps, uiPtr)					((ps)->pucBuffer + ((uiPtr) & (ps)->uiBufferMask) * (ps)->uiElementSize)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static void		BufferShmView(SRingBufferShm* psRingBuffer,
+							  void* pvMapping,
+							  UINT64 uiMappingSize,
+							  UINT64 uiDataOffset,
+							  UINT64 uiBufferSize,
+							  UINT32 uiElementSize);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Create a shared segment holding an empty ring buffer and map it
+//
+//	@param	: 	psRingBuffer receives the view of the segment from this process
+//	@param	: 	pcName is the name of the segment, "/name" as for shm_open
+//	@param	:	uiBufferSize is the number of elements in the buffer, a power of two
+//	@param	:	uiElementSize is the size in byte of each elements in the buffer
+//	@return	: 	TRUE if creating successfully, FALSE if the geometry is invalid, the name is already
+//				used or the segment cannot be created
+//	@note	:	The segment is marked ready last, so a process attaching meanwhile is refused instead
+//				of seeing a half-initialized header. It lives until BufferShmUnlink
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShmCreate(SRingBufferShm* psRingBuffer,
+					 const char* pcName,
+					 UINT64 uiBufferSize,
+					 UINT32 uiElementSize)
+{
+	SBufferShmHeader*	psHeader		= NULL;
+	void*				pvMapping		= MAP_FAILED;
+	UINT64				uiDataOffset	= sizeof(SBufferShmHeader);
+	UINT64				uiMappingSize	= 0;
+	int					iFd				= -1;
+
+	if ((uiBufferSize == 0) || ((uiBufferSize & (uiBufferSize - 1)) != 0) || (uiElementSize == 0) ||
+		(uiBufferSize > ((~(UINT64)0 >> 1) - uiDataOffset) / uiElementSize))
+	{
+		return FALSE;
+	}
+
+	uiMappingSize = uiDataOffset + uiBufferSize * uiElementSize;
+
+	iFd = shm_open(pcName, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (iFd < 0)
+	{
+		return FALSE;
+	}
+
+	if (ftruncate(iFd, (off_t)uiMappingSize) == 0)
+	{
+		pvMapping = mmap(NULL, uiMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, iFd, 0);
+	}
+
+	close(iFd);
+
+	if (pvMapping == MAP_FAILED)
+	{
+		shm_unlink(pcName);
+		return FALSE;
+	}
+
+	// The new segment is zero-filled, only the geometry and the pointers are written
+	psHeader				= (SBufferShmHeader*)pvMapping;
+	psHeader->uiVersion		= BUFFER_SHM_VERSION;
+	psHeader->uiHeaderSize	= sizeof(SBufferShmHeader);
+	psHeader->uiDataOffset	= uiDataOffset;
+	psHeader->uiBufferSize	= uiBufferSize;
+	psHeader->uiElementSize	= uiElementSize;
+	atomic_init(&psHeader->uiBufferPushPtr, 0);
+	atomic_init(&psHeader->uiBufferPopPtr, 0);
+
+	// Publish the segment to the attaching processes
+	atomic_store_explicit(&psHeader->uiMagic, BUFFER_SHM_MAGIC, memory_order_release);
+
+	BufferShmView(psRingBuffer, pvMapping, uiMappingSize, uiDataOffset, uiBufferSize, uiElementSize);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Map a shared segment created by another process
+//
+//	@param	: 	psRingBuffer receives the view of the segment from this process
+//	@param	: 	pcName is the name of the segment, "/name" as for shm_open
+//	@param	:	uiBufferSize is the number of elements expected in the buffer, 0 accepts any
+//	@param	:	uiElementSize is the size in byte expected for each element, 0 accepts any
+//	@return	: 	TRUE if attaching successfully, FALSE if the segment does not exist, is not ready yet,
+//				has another layout version or does not have the expected geometry
+//	@note	:	The geometry is validated once here and copied into psRingBuffer, so the other process
+//				cannot make this one access outside the mapping later
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShmAttach(SRingBufferShm* psRingBuffer,
+					 const char* pcName,
+					 UINT64 uiBufferSize,
+					 UINT32 uiElementSize)
+{
+	SBufferShmHeader*	psHeader		= NULL;
+	void*				pvMapping		= MAP_FAILED;
+	struct stat			sStat;
+	UINT64				uiMappingSize	= 0;
+	UINT64				uiDataOffset	= 0;
+	BOOL				bResult			= FALSE;
+	int					iFd				= -1;
+
+	iFd = shm_open(pcName, O_RDWR, 0);
+	if (iFd < 0)
+	{
+		return FALSE;
+	}
+
+	if ((fstat(iFd, &sStat) == 0) && (sStat.st_size >= (off_t)sizeof(SBufferShmHeader)))
+	{
+		uiMappingSize	= (UINT64)sStat.st_size;
+		pvMapping		= mmap(NULL, uiMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, iFd, 0);
+	}
+
+	close(iFd);
+
+	if (pvMapping == MAP_FAILED)
+	{
+		return FALSE;
+	}
+
+	psHeader = (SBufferShmHeader*)pvMapping;
+
+	if ((atomic_load_explicit(&psHeader->uiMagic, memory_order_acquire) == BUFFER_SHM_MAGIC) &&
+		(psHeader->uiVersion == BUFFER_SHM_VERSION) &&
+		(psHeader->uiHeaderSize == sizeof(SBufferShmHeader)))
+	{
+		// Take a copy of the geometry and check it against the mapping before trusting it. Only the
+		// copy is used from now on, the other process may still change the header
+		bResult			= ((uiBufferSize == 0) || (psHeader->uiBufferSize == uiBufferSize)) &&
+						  ((uiElementSize == 0) || (psHeader->uiElementSize == uiElementSize));
+		uiDataOffset	= psHeader->uiDataOffset;
+		uiBufferSize	= psHeader->uiBufferSize;
+		uiElementSize	= psHeader->uiElementSize;
+		bResult			= bResult && (uiBufferSize != 0) && ((uiBufferSize & (uiBufferSize - 1)) == 0) && (uiElementSize != 0) &&
+						  (uiDataOffset >= sizeof(SBufferShmHeader)) &&
+						  (uiDataOffset <= uiMappingSize) &&
+						  (uiBufferSize <= (uiMappingSize - uiDataOffset) / uiElementSize);
+	}
+
+	if (bResult == FALSE)
+	{
+		munmap(pvMapping, uiMappingSize);
+		return FALSE;
+	}
+
+	BufferShmView(psRingBuffer, pvMapping, uiMappingSize, uiDataOffset, uiBufferSize, uiElementSize);
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Unmap a shared segment from this process
+//
+//	@param	: 	psRingBuffer is the view of the segment, given by BufferShmCreate or BufferShmAttach
+//	@return	: 	Void
+//	@note	:	The segment and its data stay for the other processes
+// ---------------------------------------------------------------------------------------------------
+void BufferShmDetach(SRingBufferShm* psRingBuffer)
+{
+	if (psRingBuffer->psHeader != NULL)
+	{
+		munmap(psRingBuffer->psHeader, psRingBuffer->uiMappingSize);
+		psRingBuffer->psHeader	= NULL;
+		psRingBuffer->pucBuffer	= NULL;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Remove the name of a shared segment
+//
+//	@param	: 	pcName is the name of the segment
+//	@return	: 	TRUE if removing successfully and vice versa
+//	@note	:	The segment is freed once every process has detached from it
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShmUnlink(const char* pcName)
+{
+	return (shm_unlink(pcName) == 0) ? TRUE : FALSE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer
+//
+//	@param	: 	psRingBuffer is the view of the segment
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	Must be called from the push side only, by one process
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShmPushStream(SRingBufferShm* psRingBuffer, void* pvStream, UINT64 uiLength)
+{
+	SBufferShmHeader*	psHeader		= psRingBuffer->psHeader;
+	UINT64				uiPushPtr		= atomic_load_explicit(&psHeader->uiBufferPushPtr, memory_order_relaxed);
+	UINT64				uiSlot			= uiPushPtr & psRingBuffer->uiBufferMask;
+	UINT64				uiFirstLength	= 0;
+
+	// Only reload the pop pointer of the other side when the cached one says there is not enough room
+	if ((uiPushPtr - psRingBuffer->uiCachedPopPtr + uiLength) > psRingBuffer->uiBufferSize)
+	{
+		psRingBuffer->uiCachedPopPtr = atomic_load_explicit(&psHeader->uiBufferPopPtr, memory_order_acquire);
+		if ((uiPushPtr - psRingBuffer->uiCachedPopPtr + uiLength) > psRingBuffer->uiBufferSize)
+		{
+			return FALSE;
+		}
+	}
+
+	// If the pushing address is out of address range of the buffer then we need to push twice
+	if ((uiSlot + uiLength) > psRingBuffer->uiBufferSize)
+	{
+		uiFirstLength = psRingBuffer->uiBufferSize - uiSlot;
+		memcpy(SHM_SLOT(psRingBuffer, uiPushPtr), pvStream, psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy(psRingBuffer->pucBuffer, (UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->uiElementSize * (uiLength - uiFirstLength));
+	}
+	else
+	{
+		memcpy(SHM_SLOT(psRingBuffer, uiPushPtr), pvStream, psRingBuffer->uiElementSize * uiLength);
+	}
+
+	// Publish the new elements to the pop side
+	atomic_store_explicit(&psHeader->uiBufferPushPtr, uiPushPtr + uiLength, memory_order_release);
+
+	return TRUE;	// Push successfully
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer
+//
+//	@param	: 	psRingBuffer is the view of the segment
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Must be called from the pop side only, by one process
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferShmPopStream(SRingBufferShm* psRingBuffer, void* pvStream, UINT64 uiLength)
+{
+	SBufferShmHeader*	psHeader		= psRingBuffer->psHeader;
+	UINT64				uiPopPtr		= atomic_load_explicit(&psHeader->uiBufferPopPtr, memory_order_relaxed);
+	UINT64				uiSlot			= uiPopPtr & psRingBuffer->uiBufferMask;
+	UINT64				uiPopCount		= psRingBuffer->uiCachedPushPtr - uiPopPtr;
+	UINT64				uiFirstLength	= 0;
+
+	// Only reload the push pointer of the other side when the cached one cannot satisfy the request
+	if (uiPopCount < uiLength)
+	{
+		psRingBuffer->uiCachedPushPtr = atomic_load_explicit(&psHeader->uiBufferPushPtr, memory_order_acquire);
+		uiPopCount = psRingBuffer->uiCachedPushPtr - uiPopPtr;
+
+		// A corrupted push pointer must not make this process read outside the data area
+		if ((uiPopCount == 0) || (uiPopCount > psRingBuffer->uiBufferSize))
+		{
+			return 0;
+		}
+	}
+
+	// Limit length of data stream will be popped
+	if (uiLength < uiPopCount)
+	{
+		uiPopCount = uiLength;
+	}
+
+	// If the popping address is out of address range of the buffer then we need to pop twice
+	if ((uiSlot + uiPopCount) > psRingBuffer->uiBufferSize)
+	{
+		uiFirstLength = psRingBuffer->uiBufferSize - uiSlot;
+		memcpy(pvStream, SHM_SLOT(psRingBuffer, uiPopPtr), psRingBuffer->uiElementSize * uiFirstLength);
+		memcpy((UCHAR*)pvStream + uiFirstLength * psRingBuffer->uiElementSize, psRingBuffer->pucBuffer, psRingBuffer->uiElementSize * (uiPopCount - uiFirstLength));
+	}
+	else
+	{
+		memcpy(pvStream, SHM_SLOT(psRingBuffer, uiPopPtr), psRingBuffer->uiElementSize * uiPopCount);
+	}
+
+	// Hand the freed elements back to the push side
+	atomic_store_explicit(&psHeader->uiBufferPopPtr, uiPopPtr + uiPopCount, memory_order_release);
+
+	return uiPopCount;	// Return the number of elements popped out actually
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer
+//
+//	@param	: 	psRingBuffer is the view of the segment
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:	Must be called from the push side only, by one process
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferShmPush(SRingBufferShm* psRingBuffer, void* pvData)
+{
+	return BufferShmPushStream(psRingBuffer, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from ring buffer
+//
+//	@param	: 	psRingBuffer is the view of the segment
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:	Must be called from the pop side only, by one process
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferShmPop(SRingBufferShm* psRingBuffer, void* pvData)
+{
+	return BufferShmPopStream(psRingBuffer, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of the buffer
+//
+//	@param	: 	psRingBuffer is the view of the segment
+//	@return	: 	Element count of the buffer
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferShmGetCount(SRingBufferShm* psRingBuffer)
+{
+	UINT64	uiPopPtr	= atomic_load_explicit(&psRingBuffer->psHeader->uiBufferPopPtr, memory_order_acquire);
+	UINT64	uiPushPtr	= atomic_load_explicit(&psRingBuffer->psHeader->uiBufferPushPtr, memory_order_acquire);
+
+	return uiPushPtr - uiPopPtr;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the available (free or can be used for pushing) element count of the buffer
+//
+//	@param	: 	psRingBuffer is the view of the segment
+//	@return	: 	Available element count of the buffer
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferShmGetAvailableCount(SRingBufferShm* psRingBuffer)
+{
+	return psRingBuffer->uiBufferSize - BufferShmGetCount(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Fill the view of a mapped segment
+//
+//	@param	: 	psRingBuffer is the view
+//	@param	: 	pvMapping is the segment, mapped and validated
+//	@param	: 	uiMappingSize is the size of the mapping in byte
+//	@param	: 	uiDataOffset is the validated offset of the data area in the segment
+//	@param	:	uiBufferSize is the validated number of elements in the buffer
+//	@param	:	uiElementSize is the validated size in byte of each element
+//	@return	: 	Void
+//	@note	:	The geometry is taken from the parameters, never from the shared header
+// ---------------------------------------------------------------------------------------------------
+static void BufferShmView(SRingBufferShm* psRingBuffer,
+						  void* pvMapping,
+						  UINT64 uiMappingSize,
+						  UINT64 uiDataOffset,
+						  UINT64 uiBufferSize,
+						  UINT32 uiElementSize)
+{
+	SBufferShmHeader*	psHeader	= (SBufferShmHeader*)pvMapping;
+
+	psRingBuffer->psHeader			= psHeader;
+	psRingBuffer->pucBuffer			= (UCHAR*)pvMapping + uiDataOffset;
+	psRingBuffer->uiMappingSize		= uiMappingSize;
+	psRingBuffer->uiBufferSize		= uiBufferSize;
+	psRingBuffer->uiBufferMask		= uiBufferSize - 1;
+	psRingBuffer->uiElementSize		= uiElementSize;
+	psRingBuffer->uiCachedPopPtr	= atomic_load_explicit(&psHeader->uiBufferPopPtr, memory_order_acquire);
+	psRingBuffer->uiCachedPushPtr	= atomic_load_explicit(&psHeader->uiBufferPushPtr, memory_order_acquire);
+}
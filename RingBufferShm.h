@@ -0,0 +1,102 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferShm.h
+// 	Brief 		: 	Single-producer/single-consumer ring buffer shared between processes. The header and
+//					the data area live in one POSIX shared memory segment and refer to each other by
+//					offsets only, so every process can map the segment at its own address
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (shm_open and mmap)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Align with BUFFER_ALIGNED instead of _Alignas
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_SHM_H_
+#define _RING_BUFFER_SHM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <stdatomic.h>
+#include "TypeDef.h"
+#include "RingBufferConfig.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Identification of a shared segment, written last by the creator
+#define BUFFER_SHM_MAGIC			0x52425348UL	// "RBSH"
+
+// Layout version of a shared segment, to be increased with every change of SBufferShmHeader
+#define BUFFER_SHM_VERSION			1
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Header at the start of a shared segment. It holds no pointer: the data area is found by its offset
+// from the start of the segment
+typedef struct S_BUFFER_SHM_HEADER
+{
+	// Read-only after creation
+	_Atomic UINT32			uiMagic;					// BUFFER_SHM_MAGIC once the segment is ready
+	UINT32					uiVersion;					// BUFFER_SHM_VERSION of the creator
+	UINT32					uiHeaderSize;				// sizeof(SBufferShmHeader) of the creator
+	UINT64					uiDataOffset;				// Offset of the data area from the start of the segment
+	UINT64					uiBufferSize;				// Size of buffer or the total of elements, a power of two
+	UINT32					uiElementSize;				// Size of each element of the buffer in byte
+
+	// Owned by the push side
+	BUFFER_ALIGNED
+	_Atomic UINT64			uiBufferPushPtr;			// The pointer to start writing, runs freely
+
+	// Owned by the pop side
+	BUFFER_ALIGNED
+	_Atomic UINT64			uiBufferPopPtr;				// The pointer to start reading, runs freely
+
+} SBufferShmHeader;
+
+// View of a shared segment from one process. Each process has its own
+typedef struct S_RING_BUFFER_SHM
+{
+	SBufferShmHeader*		psHeader;					// The segment, mapped in this process
+	UCHAR*					pucBuffer;					// Data area of the segment
+	UINT64					uiMappingSize;				// Size of the mapping in byte
+	UINT64					uiBufferSize;				// Copy of the geometry, validated once
+	UINT64					uiBufferMask;				// uiBufferSize - 1
+	UINT32					uiElementSize;				// Copy of the geometry, validated once
+	UINT64					uiCachedPopPtr;				// Last pop pointer seen by the push side
+	UINT64					uiCachedPushPtr;			// Last push pointer seen by the pop side
+
+} SRingBufferShm;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferShmCreate(SRingBufferShm* psRingBuffer,
+								const char* pcName,
+								UINT64 uiBufferSize,
+								UINT32 uiElementSize);
+BOOL			BufferShmAttach(SRingBufferShm* psRingBuffer,
+								const char* pcName,
+								UINT64 uiBufferSize,
+								UINT32 uiElementSize);
+void			BufferShmDetach(SRingBufferShm* psRingBuffer);
+BOOL			BufferShmUnlink(const char* pcName);
+
+BOOL 			BufferShmPushStream(SRingBufferShm* psRingBuffer, void* pvStream, UINT64 uiLength);
+UINT64 			BufferShmPopStream(SRingBufferShm* psRingBuffer, void* pvStream, UINT64 uiLength);
+BOOL 			BufferShmPush(SRingBufferShm* psRingBuffer, void* pvData);
+UINT64			BufferShmPop(SRingBufferShm* psRingBuffer, void* pvData);
+UINT64			BufferShmGetCount(SRingBufferShm* psRingBuffer);
+UINT64			BufferShmGetAvailableCount(SRingBufferShm* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_SHM_H_
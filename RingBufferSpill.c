@@ -0,0 +1,389 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferSpill.c
+// 	Brief 		: 	Overflow tier of the ring buffer. When the ring buffer is full the pushed elements go
+//					to a chain of memory-mapped segment files on disk, and they are moved back into the
+//					ring buffer as the consumer frees room, before any newer element. The order of the
+//					elements is kept and the disk usage is bounded by the number of segments
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (mmap)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "RingBufferSpill.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Segment of the chain at a position counted from the oldest one
+#define SPILL_SEGMENT(ps, uiPosition)		(&(ps)->asSegment[((ps)->uiHeadSegment + (uiPosition)) % RING_BUFFER_SPILL_SEGMENTS])
+
+// Size in byte of a segment file
+#define SPILL_SEGMENT_BYTES(ps)				((size_t)(ps)->uiSegmentSize * (ps)->psRingBuffer->uiElementSize)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static BOOL		BufferSpillAppend(SRingBufferSpill* psSpill, UCHAR* pucStream, UINT64 uiLength);
+static void		BufferSpillRefill(SRingBufferSpill* psSpill);
+static BOOL		BufferSpillOpenSegment(SRingBufferSpill* psSpill, SBufferSpillSegment* psSegment);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Add an overflow tier to a ring buffer
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@param	: 	psRingBuffer is the ring buffer, already initialized. If the producer and the consumer
+//				run on different threads it must have a lock
+//	@param	:	pcDirectory is the directory of the segment files, on a local disk
+//	@param	:	uiSegmentSize is the number of elements of each segment file
+//	@param	:	uiMaxSegments is the maximum number of segment files at once, up to
+//				RING_BUFFER_SPILL_SEGMENTS. The disk usage is at most uiMaxSegments * uiSegmentSize
+//				elements
+//	@return	: 	TRUE if initializing successfully and vice versa
+//	@note	:	The ring buffer must then be pushed and popped through BufferSpillxxx only
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferSpillInit(SRingBufferSpill* psSpill,
+					 SRingBuffer* psRingBuffer,
+					 const char* pcDirectory,
+					 UINT64 uiSegmentSize,
+					 UINT16 uiMaxSegments)
+{
+	if ((uiSegmentSize == 0) || (uiMaxSegments == 0) || (uiMaxSegments > RING_BUFFER_SPILL_SEGMENTS) ||
+		(strlen(pcDirectory) >= sizeof(psSpill->acDirectory)))
+	{
+		return FALSE;
+	}
+
+	if (pthread_mutex_init(&psSpill->sMutex, NULL) != 0)
+	{
+		return FALSE;
+	}
+
+	strcpy(psSpill->acDirectory, pcDirectory);
+	psSpill->psRingBuffer		= psRingBuffer;
+	psSpill->uiSegmentSize		= uiSegmentSize;
+	psSpill->uiMaxSegments		= uiMaxSegments;
+	psSpill->uiSegmentSequence	= 0;
+	psSpill->uiSpilledCount		= 0;
+	psSpill->uiHeadSegment		= 0;
+	psSpill->uiSegmentCount		= 0;
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Remove the overflow tier of a ring buffer
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@return	: 	Void
+//	@note	:	The elements still in the segment files are lost. The ring buffer is left as it is
+// ---------------------------------------------------------------------------------------------------
+void BufferSpillDeinit(SRingBufferSpill* psSpill)
+{
+	while (psSpill->uiSegmentCount > 0)
+	{
+		munmap(SPILL_SEGMENT(psSpill, 0)->pucData, SPILL_SEGMENT_BYTES(psSpill));
+		psSpill->uiHeadSegment = (psSpill->uiHeadSegment + 1) % RING_BUFFER_SPILL_SEGMENTS;
+		psSpill->uiSegmentCount--;
+	}
+
+	psSpill->uiSpilledCount = 0;
+	pthread_mutex_destroy(&psSpill->sMutex);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer, or into the segment files if it is full
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	TRUE if pushing successfully, FALSE if neither the ring buffer nor the segment files
+//				have room for the whole stream
+//	@note	:	Once elements are spilled, the newer ones follow them to disk until they are all moved
+//				back, so that no element overtakes an older one
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferSpillPushStream(SRingBufferSpill* psSpill, void* pvStream, BUFFER_INDEX uiLength)
+{
+	BOOL	bResult	= FALSE;
+
+	// Only the producer makes the spilled count non-zero, so it cannot change behind this check
+	if ((__atomic_load_n(&psSpill->uiSpilledCount, __ATOMIC_ACQUIRE) == 0) &&
+		(BufferPushStream(psSpill->psRingBuffer, pvStream, uiLength) == TRUE))
+	{
+		return TRUE;
+	}
+
+	pthread_mutex_lock(&psSpill->sMutex);
+	bResult = BufferSpillAppend(psSpill, (UCHAR*)pvStream, uiLength);
+	pthread_mutex_unlock(&psSpill->sMutex);
+
+	return bResult;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer, moving the spilled elements back into it
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@return	: 	The number of elements popped out actually
+//	@note	:	The spilled elements are moved back before and after popping, in their order
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferSpillPopStream(SRingBufferSpill* psSpill, void* pvStream, BUFFER_INDEX uiLength)
+{
+	BUFFER_INDEX	uiPopCount	= 0;
+
+	if (__atomic_load_n(&psSpill->uiSpilledCount, __ATOMIC_ACQUIRE) != 0)
+	{
+		BufferSpillRefill(psSpill);
+	}
+
+	uiPopCount = BufferPopStream(psSpill->psRingBuffer, pvStream, uiLength);
+
+	if ((uiPopCount > 0) && (__atomic_load_n(&psSpill->uiSpilledCount, __ATOMIC_ACQUIRE) != 0))
+	{
+		BufferSpillRefill(psSpill);
+	}
+
+	return uiPopCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer, or into the segment files if it is full
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@return	: 	TRUE if pushing successfully and vice versa
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferSpillPush(SRingBufferSpill* psSpill, void* pvData)
+{
+	return BufferSpillPushStream(psSpill, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from ring buffer, moving the spilled elements back into it
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@return	: 	The number of elements popped out actually
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferSpillPop(SRingBufferSpill* psSpill, void* pvData)
+{
+	return BufferSpillPopStream(psSpill, pvData, 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of the ring buffer and the segment files together
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@return	: 	Element count
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferSpillGetCount(SRingBufferSpill* psSpill)
+{
+	return BufferGetCount(psSpill->psRingBuffer) + BufferSpillGetSpilledCount(psSpill);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the element count of the segment files
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@return	: 	Element count of the segment files
+//	@note	:	The result is a snapshot and may be out of date as soon as it is returned
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferSpillGetSpilledCount(SRingBufferSpill* psSpill)
+{
+	return __atomic_load_n(&psSpill->uiSpilledCount, __ATOMIC_ACQUIRE);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Write a stream at the end of the chain of segment files
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@param	: 	pucStream is the data stream
+//	@param	: 	uiLength is the length of data stream
+//	@return	: 	TRUE if writing successfully, FALSE if the chain has no room for the whole stream
+//	@note	:	Called with the chain locked. The segments the stream needs are all opened before it is
+//				written, so that a stream is either spilled whole or not at all
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferSpillAppend(SRingBufferSpill* psSpill, UCHAR* pucStream, UINT64 uiLength)
+{
+	SBufferSpillSegment*	psSegment		= NULL;
+	UINT64					uiTailRoom		= 0;
+	UINT64					uiWriteLength	= 0;
+	UINT16					uiNewSegments	= 0;
+	UINT16					uiPosition		= 0;
+	UINT16					uiElementSize	= psSpill->psRingBuffer->uiElementSize;
+
+	if (psSpill->uiSegmentCount > 0)
+	{
+		uiTailRoom = psSpill->uiSegmentSize - SPILL_SEGMENT(psSpill, psSpill->uiSegmentCount - 1)->uiWriteCount;
+	}
+
+	if (uiLength > uiTailRoom)
+	{
+		if ((uiLength - uiTailRoom) > (UINT64)(psSpill->uiMaxSegments - psSpill->uiSegmentCount) * psSpill->uiSegmentSize)
+		{
+			return FALSE;
+		}
+
+		uiNewSegments = (UINT16)((uiLength - uiTailRoom + psSpill->uiSegmentSize - 1) / psSpill->uiSegmentSize);
+	}
+
+	for (uiPosition = 0; uiPosition < uiNewSegments; uiPosition++)
+	{
+		if (BufferSpillOpenSegment(psSpill, SPILL_SEGMENT(psSpill, psSpill->uiSegmentCount + uiPosition)) == FALSE)
+		{
+			while (uiPosition-- > 0)
+			{
+				munmap(SPILL_SEGMENT(psSpill, psSpill->uiSegmentCount + uiPosition)->pucData, SPILL_SEGMENT_BYTES(psSpill));
+			}
+			return FALSE;
+		}
+	}
+
+	// Fill the last segment, then the new ones
+	uiPosition				= (psSpill->uiSegmentCount > 0) ? (psSpill->uiSegmentCount - 1) : 0;
+	psSpill->uiSegmentCount	+= uiNewSegments;
+
+	while (uiLength > 0)
+	{
+		psSegment		= SPILL_SEGMENT(psSpill, uiPosition);
+		uiWriteLength	= psSpill->uiSegmentSize - psSegment->uiWriteCount;
+		if (uiLength < uiWriteLength)
+		{
+			uiWriteLength = uiLength;
+		}
+
+		memcpy(psSegment->pucData + psSegment->uiWriteCount * uiElementSize, pucStream, uiWriteLength * uiElementSize);
+		psSegment->uiWriteCount += uiWriteLength;
+		pucStream				+= uiWriteLength * uiElementSize;
+		uiLength				-= uiWriteLength;
+		uiPosition++;
+
+		// Publish the elements to the consumer
+		__atomic_store_n(&psSpill->uiSpilledCount, psSpill->uiSpilledCount + uiWriteLength, __ATOMIC_RELEASE);
+	}
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Move the oldest spilled elements back into the room of the ring buffer
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@return	: 	Void
+//	@note	:	Segment files are released as soon as they are drained. The producer does not push
+//				into the ring buffer meanwhile, because the spilled count is not zero until the last
+//				spilled element is in the ring buffer
+// ---------------------------------------------------------------------------------------------------
+static void BufferSpillRefill(SRingBufferSpill* psSpill)
+{
+	SBufferSpillSegment*	psSegment		= NULL;
+	UINT64					uiMoveLength	= 0;
+	BUFFER_INDEX			uiRoom			= 0;
+	UINT16					uiElementSize	= psSpill->psRingBuffer->uiElementSize;
+
+	pthread_mutex_lock(&psSpill->sMutex);
+
+	while (psSpill->uiSegmentCount > 0)
+	{
+		psSegment		= SPILL_SEGMENT(psSpill, 0);
+		uiRoom			= BufferGetAvailableCount(psSpill->psRingBuffer);
+		uiMoveLength	= psSegment->uiWriteCount - psSegment->uiReadCount;
+		if (uiRoom < uiMoveLength)
+		{
+			uiMoveLength = uiRoom;
+		}
+
+		if ((uiMoveLength > 0) &&
+			(BufferPushStream(psSpill->psRingBuffer, psSegment->pucData + psSegment->uiReadCount * uiElementSize, (BUFFER_INDEX)uiMoveLength) == TRUE))
+		{
+			psSegment->uiReadCount += uiMoveLength;
+			__atomic_store_n(&psSpill->uiSpilledCount, psSpill->uiSpilledCount - uiMoveLength, __ATOMIC_RELEASE);
+		}
+
+		// Release the oldest segment once it is drained and the producer has left it
+		if ((psSegment->uiReadCount == psSpill->uiSegmentSize) ||
+			((psSegment->uiReadCount == psSegment->uiWriteCount) && (psSpill->uiSegmentCount == 1)))
+		{
+			munmap(psSegment->pucData, SPILL_SEGMENT_BYTES(psSpill));
+			psSpill->uiHeadSegment = (psSpill->uiHeadSegment + 1) % RING_BUFFER_SPILL_SEGMENTS;
+			psSpill->uiSegmentCount--;
+		}
+		else
+		{
+			break;	// The ring buffer is full again
+		}
+	}
+
+	pthread_mutex_unlock(&psSpill->sMutex);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Create and map a segment file
+//
+//	@param	: 	psSpill is the structure of the overflow tier
+//	@param	: 	psSegment receives the segment
+//	@return	: 	TRUE if creating successfully and vice versa
+//	@note	:	The disk blocks are allocated up front, so that a full disk fails here instead of
+//				faulting on a write through the mapping later. The file is removed from the directory
+//				at once: the mapping keeps it, and nothing is left behind after a crash
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferSpillOpenSegment(SRingBufferSpill* psSpill, SBufferSpillSegment* psSegment)
+{
+	char	acPath[PATH_MAX];
+	void*	pvMapping	= MAP_FAILED;
+	int		iFd			= -1;
+
+	if (snprintf(acPath, sizeof(acPath), "%s/RingBufferSpill-%d-%llu.seg", psSpill->acDirectory, (int)getpid(), psSpill->uiSegmentSequence++) >= (int)sizeof(acPath))
+	{
+		return FALSE;
+	}
+
+	iFd = open(acPath, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	if (iFd < 0)
+	{
+		return FALSE;
+	}
+
+	unlink(acPath);
+
+	if (posix_fallocate(iFd, 0, (off_t)SPILL_SEGMENT_BYTES(psSpill)) == 0)
+	{
+		pvMapping = mmap(NULL, SPILL_SEGMENT_BYTES(psSpill), PROT_READ | PROT_WRITE, MAP_SHARED, iFd, 0);
+	}
+
+	close(iFd);
+
+	if (pvMapping == MAP_FAILED)
+	{
+		return FALSE;
+	}
+
+	// Each segment is written once and read once, front to back
+	madvise(pvMapping, SPILL_SEGMENT_BYTES(psSpill), MADV_SEQUENTIAL);
+
+	psSegment->pucData		= (UCHAR*)pvMapping;
+	psSegment->uiWriteCount	= 0;
+	psSegment->uiReadCount	= 0;
+
+	return TRUE;
+}
@@ -0,0 +1,82 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferSpill.h
+// 	Brief 		: 	Overflow tier of the ring buffer. When the ring buffer is full the pushed elements go
+//					to a chain of memory-mapped segment files on disk, and they are moved back into the
+//					ring buffer as the consumer frees room, before any newer element. The order of the
+//					elements is kept and the disk usage is bounded by the number of segments
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only (mmap)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_SPILL_H_
+#define _RING_BUFFER_SPILL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <limits.h>
+#include <pthread.h>
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Segment file of the overflow tier
+typedef struct S_BUFFER_SPILL_SEGMENT
+{
+	UCHAR*					pucData;					// The file, mapped
+	UINT64					uiWriteCount;				// Elements written into the segment
+	UINT64					uiReadCount;				// Elements moved back into the ring buffer
+
+} SBufferSpillSegment;
+
+// Ring buffer with an overflow tier
+typedef struct S_RING_BUFFER_SPILL
+{
+	SRingBuffer*			psRingBuffer;				// The in-memory ring buffer
+	char					acDirectory[PATH_MAX];		// Directory of the segment files
+	UINT64					uiSegmentSize;				// Elements of each segment file
+	UINT16					uiMaxSegments;				// Maximum number of segment files at once
+	UINT64					uiSegmentSequence;			// Number of the next segment file
+	UINT64					uiSpilledCount;				// Elements in the segment files
+	UINT16					uiHeadSegment;				// Oldest segment of the chain
+	UINT16					uiSegmentCount;				// Segments in the chain
+	SBufferSpillSegment		asSegment[RING_BUFFER_SPILL_SEGMENTS];	// The chain, a circular list
+	pthread_mutex_t			sMutex;						// Protects the chain
+
+} SRingBufferSpill;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferSpillInit(SRingBufferSpill* psSpill,
+								SRingBuffer* psRingBuffer,
+								const char* pcDirectory,
+								UINT64 uiSegmentSize,
+								UINT16 uiMaxSegments);
+void			BufferSpillDeinit(SRingBufferSpill* psSpill);
+
+BOOL 			BufferSpillPushStream(SRingBufferSpill* psSpill, void* pvStream, BUFFER_INDEX uiLength);
+BUFFER_INDEX	BufferSpillPopStream(SRingBufferSpill* psSpill, void* pvStream, BUFFER_INDEX uiLength);
+BOOL 			BufferSpillPush(SRingBufferSpill* psSpill, void* pvData);
+BUFFER_INDEX	BufferSpillPop(SRingBufferSpill* psSpill, void* pvData);
+UINT64			BufferSpillGetCount(SRingBufferSpill* psSpill);
+UINT64			BufferSpillGetSpilledCount(SRingBufferSpill* psSpill);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_SPILL_H_
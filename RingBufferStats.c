@@ -0,0 +1,152 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferStats.c
+// 	Brief 		: 	Statistics of the ring buffer: calls and elements of each side, rejections on full
+//					and empty, the high-water mark of the element count and a histogram of the time
+//					spent waiting for the lock. The counters of each side sit on their own cache line
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_STATS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Take the clock from RingBufferInternal.h
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBufferStats.h"
+#include "RingBufferInternal.h"
+
+#if (RING_BUFFER_ENABLE_STATS != 1)
+	#error "RingBufferStats.c requires RING_BUFFER_ENABLE_STATS to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static void		BufferStatsCopySide(SBufferStatsSide* psSide, UINT64 auiLockWait[RING_BUFFER_STATS_BUCKETS]);
+static void		BufferStatsClearSide(SBufferStatsSide* psSide);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Take a consistent copy of the statistics of a ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	psStats receives the statistics
+//	@return	: 	Void
+//	@note	:	The rejection counters are updated without the lock and may be a few calls ahead
+// ---------------------------------------------------------------------------------------------------
+void BufferStatsSnapshot(SRingBuffer* psRingBuffer, SBufferStats* psStats)
+{
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	psStats->uiPushCallCount	= __atomic_load_n(&psRingBuffer->sPushStats.uiCallCount, __ATOMIC_RELAXED);
+	psStats->uiPushElementCount	= __atomic_load_n(&psRingBuffer->sPushStats.uiElementCount, __ATOMIC_RELAXED);
+	psStats->uiPushRejectCount	= __atomic_load_n(&psRingBuffer->sPushStats.uiRejectCount, __ATOMIC_RELAXED);
+	psStats->uiPopCallCount		= __atomic_load_n(&psRingBuffer->sPopStats.uiCallCount, __ATOMIC_RELAXED);
+	psStats->uiPopElementCount	= __atomic_load_n(&psRingBuffer->sPopStats.uiElementCount, __ATOMIC_RELAXED);
+	psStats->uiPopRejectCount	= __atomic_load_n(&psRingBuffer->sPopStats.uiRejectCount, __ATOMIC_RELAXED);
+	psStats->uiHighWaterMark	= __atomic_load_n(&psRingBuffer->sPushStats.uiHighWaterMark, __ATOMIC_RELAXED);
+
+	BufferStatsCopySide(&psRingBuffer->sPushStats, psStats->auiPushLockWait);
+	BufferStatsCopySide(&psRingBuffer->sPopStats, psStats->auiPopLockWait);
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Clear the statistics of a ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	The high-water mark restarts from the current element count
+// ---------------------------------------------------------------------------------------------------
+void BufferStatsReset(SRingBuffer* psRingBuffer)
+{
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	BufferStatsClearSide(&psRingBuffer->sPushStats);
+	BufferStatsClearSide(&psRingBuffer->sPopStats);
+	BUFFER_STATS_SET(psRingBuffer->sPushStats.uiHighWaterMark, BufferGetCount(psRingBuffer));
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Lock a ring buffer and record the time spent waiting for the lock
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	psSide is the statistics of the side taking the lock
+//	@return	: 	Void
+//	@note	:	Called through BUFFER_LOCK_PUSH/BUFFER_LOCK_POP when the buffer has a lock
+// ---------------------------------------------------------------------------------------------------
+void BufferStatsLock(SRingBuffer* psRingBuffer, SBufferStatsSide* psSide)
+{
+	UINT64	uiStart		= BufferNow();
+	UINT64	uiWait		= 0;
+	UINT16	uiBucket	= 0;
+
+	BUFFER_LOCK(psRingBuffer);
+
+	// The bucket is the bit length of the wait in nanoseconds
+	uiWait = BufferNow() - uiStart;
+	while ((uiWait != 0) && (uiBucket < RING_BUFFER_STATS_BUCKETS - 1))
+	{
+		uiWait >>= 1;
+		uiBucket++;
+	}
+
+	BUFFER_STATS_ADD(psSide->auiLockWait[uiBucket], 1);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Copy the lock-wait histogram of one side
+//
+//	@param	: 	psSide is the statistics of the side
+//	@param	: 	auiLockWait receives the histogram
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BufferStatsCopySide(SBufferStatsSide* psSide, UINT64 auiLockWait[RING_BUFFER_STATS_BUCKETS])
+{
+	UINT16	uiBucket	= 0;
+
+	for (uiBucket = 0; uiBucket < RING_BUFFER_STATS_BUCKETS; uiBucket++)
+	{
+		auiLockWait[uiBucket] = __atomic_load_n(&psSide->auiLockWait[uiBucket], __ATOMIC_RELAXED);
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Clear the counters of one side
+//
+//	@param	: 	psSide is the statistics of the side
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static void BufferStatsClearSide(SBufferStatsSide* psSide)
+{
+	UINT16	uiBucket	= 0;
+
+	BUFFER_STATS_SET(psSide->uiCallCount, 0);
+	BUFFER_STATS_SET(psSide->uiElementCount, 0);
+	BUFFER_STATS_SET(psSide->uiRejectCount, 0);
+
+	for (uiBucket = 0; uiBucket < RING_BUFFER_STATS_BUCKETS; uiBucket++)
+	{
+		BUFFER_STATS_SET(psSide->auiLockWait[uiBucket], 0);
+	}
+}
@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferStats.h
+// 	Brief 		: 	Statistics of the ring buffer: calls and elements of each side, rejections on full
+//					and empty, the high-water mark of the element count and a histogram of the time
+//					spent waiting for the lock. The counters of each side sit on their own cache line
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_STATS to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_STATS_H_
+#define _RING_BUFFER_STATS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Snapshot of the statistics of a ring buffer
+typedef struct S_BUFFER_STATS
+{
+	UINT64					uiPushCallCount;			// Successful push calls
+	UINT64					uiPushElementCount;			// Elements pushed in
+	UINT64					uiPushRejectCount;			// Push calls rejected because the buffer was full
+	UINT64					uiPopCallCount;				// Successful pop calls
+	UINT64					uiPopElementCount;			// Elements popped out
+	UINT64					uiPopRejectCount;			// Pop calls rejected because the buffer was empty
+	BUFFER_INDEX			uiHighWaterMark;			// Highest element count seen
+	UINT64					auiPushLockWait[RING_BUFFER_STATS_BUCKETS];	// Lock waits of the push side
+	UINT64					auiPopLockWait[RING_BUFFER_STATS_BUCKETS];	// Lock waits of the pop side
+
+} SBufferStats;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Update a counter. The counters are only written with the buffer locked, so a plain load and store
+// is enough; they are atomic only to let BufferStatsSnapshot read them at any time
+#define BUFFER_STATS_ADD(uiCounter, uiValue)	\
+			__atomic_store_n(&(uiCounter), __atomic_load_n(&(uiCounter), __ATOMIC_RELAXED) + (uiValue), __ATOMIC_RELAXED)
+#define BUFFER_STATS_SET(uiCounter, uiValue)	\
+			__atomic_store_n(&(uiCounter), (uiValue), __ATOMIC_RELAXED)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+void			BufferStatsSnapshot(SRingBuffer* psRingBuffer, SBufferStats* psStats);
+void			BufferStatsReset(SRingBuffer* psRingBuffer);
+
+void			BufferStatsLock(SRingBuffer* psRingBuffer, SBufferStatsSide* psSide);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_STATS_H_
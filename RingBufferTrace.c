@@ -0,0 +1,230 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferTrace.c
+// 	Brief 		: 	Sampled queue-residency tracing of the ring buffer. Every Nth pushed element gets a
+//					monotonic timestamp in side storage, and the pop which releases it records the time
+//					it stayed queued into a log-linear (HDR style) histogram. The data format is not
+//					changed
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_TRACE_INTERVAL to be greater than 0
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Take the clock from RingBufferInternal.h
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <string.h>
+#include "RingBufferTrace.h"
+#include "RingBufferInternal.h"
+
+#if (RING_BUFFER_TRACE_INTERVAL <= 0)
+	#error "RingBufferTrace.c requires RING_BUFFER_TRACE_INTERVAL to be greater than 0"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Number of buckets of each power of two
+#define TRACE_SUB_COUNT					(1U << RING_BUFFER_TRACE_SUB_BITS)
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Move a queued sample index forward
+#define TRACE_NEXT(uiIndex)				(((uiIndex) + 1 == RING_BUFFER_TRACE_SLOTS) ? 0 : ((uiIndex) + 1))
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Take a copy of the residency histogram of a ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	psStats receives the histogram
+//	@return	: 	Void
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+void BufferTraceSnapshot(SRingBuffer* psRingBuffer, SBufferTraceStats* psStats)
+{
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	psStats->uiSampleCount	= psRingBuffer->sTrace.uiSampleCount;
+	psStats->uiDropCount	= psRingBuffer->sTrace.uiDropCount;
+	memcpy(psStats->auiHistogram, psRingBuffer->sTrace.auiHistogram, sizeof(psStats->auiHistogram));
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Clear the residency histogram of a ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	The samples still queued are kept and recorded when they are popped
+// ---------------------------------------------------------------------------------------------------
+void BufferTraceReset(SRingBuffer* psRingBuffer)
+{
+	// Lock accessing to the buffer
+	BUFFER_LOCK(psRingBuffer);
+
+	psRingBuffer->sTrace.uiSampleCount	= 0;
+	psRingBuffer->sTrace.uiDropCount	= 0;
+	memset(psRingBuffer->sTrace.auiHistogram, 0, sizeof(psRingBuffer->sTrace.auiHistogram));
+
+	// Unlock accessing to the buffer
+	BUFFER_UNLOCK(psRingBuffer);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get a percentile of the residency from a histogram snapshot
+//
+//	@param	: 	psStats is the histogram snapshot
+//	@param	: 	dPercentile is the percentile, from 0 to 100 (e.g. 99.9)
+//	@return	: 	The residency in ns, rounded down to the start of its bucket. 0 if nothing is recorded
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferTracePercentile(SBufferTraceStats* psStats, double dPercentile)
+{
+	UINT64	uiRank		= 0;
+	UINT64	uiCount		= 0;
+	UINT16	uiBucket	= 0;
+
+	if (psStats->uiSampleCount == 0)
+	{
+		return 0;
+	}
+
+	// Rank of the sample at the percentile, counted from 1
+	uiRank = (UINT64)(dPercentile / 100.0 * (double)psStats->uiSampleCount + 0.5);
+	if (uiRank == 0)
+	{
+		uiRank = 1;
+	}
+
+	for (uiBucket = 0; uiBucket < BUFFER_TRACE_BUCKETS; uiBucket++)
+	{
+		uiCount += psStats->auiHistogram[uiBucket];
+		if (uiCount >= uiRank)
+		{
+			break;
+		}
+	}
+
+	if (uiBucket == BUFFER_TRACE_BUCKETS)
+	{
+		uiBucket = BUFFER_TRACE_BUCKETS - 1;
+	}
+
+	return BufferTraceBucketValue(uiBucket);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the histogram bucket of a residency
+//
+//	@param	: 	uiNanoseconds is the residency
+//	@return	: 	The bucket index. Residencies beyond 2^RING_BUFFER_TRACE_MAX_BITS ns go to the last one
+//	@note	:	Below 2^SUB_BITS ns every value has its own bucket, above it each power of two is split
+//				into 2^SUB_BITS buckets of equal width
+// ---------------------------------------------------------------------------------------------------
+UINT16 BufferTraceBucket(UINT64 uiNanoseconds)
+{
+	UINT16	uiShift	= 0;
+
+	if (uiNanoseconds < TRACE_SUB_COUNT)
+	{
+		return (UINT16)uiNanoseconds;
+	}
+
+	// Shift the value down until only SUB_BITS bits are left below its leading bit
+	while ((uiNanoseconds >> uiShift) >= 2 * TRACE_SUB_COUNT)
+	{
+		uiShift++;
+	}
+
+	if (uiShift > RING_BUFFER_TRACE_MAX_BITS - RING_BUFFER_TRACE_SUB_BITS - 1)
+	{
+		return BUFFER_TRACE_BUCKETS - 1;
+	}
+
+	return (UINT16)(((uiShift + 1) << RING_BUFFER_TRACE_SUB_BITS) + (uiNanoseconds >> uiShift) - TRACE_SUB_COUNT);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Get the smallest residency of a histogram bucket
+//
+//	@param	: 	uiBucket is the bucket index
+//	@return	: 	The residency in ns
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+UINT64 BufferTraceBucketValue(UINT16 uiBucket)
+{
+	UINT16	uiShift	= 0;
+
+	if (uiBucket < TRACE_SUB_COUNT)
+	{
+		return uiBucket;
+	}
+
+	uiShift = (uiBucket >> RING_BUFFER_TRACE_SUB_BITS) - 1;
+
+	return ((UINT64)(uiBucket & (TRACE_SUB_COUNT - 1)) + TRACE_SUB_COUNT) << uiShift;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Take the samples due among the elements just pushed
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	Called with the buffer locked, through BUFFER_TRACE_PUSHED, only when a sample is due
+// ---------------------------------------------------------------------------------------------------
+void BufferTracePushed(SRingBuffer* psRingBuffer)
+{
+	SBufferTrace*	psTrace	= &psRingBuffer->sTrace;
+	UINT64			uiNow	= BufferNow();
+
+	// A large stream may cover several samples, they all share the push time
+	while (psTrace->uiNextSample < psTrace->uiPushTotal)
+	{
+		if (TRACE_NEXT(psTrace->uiPendingTail) == psTrace->uiPendingHead)
+		{
+			psTrace->uiDropCount++;
+		}
+		else
+		{
+			psTrace->auiPendingSequence[psTrace->uiPendingTail]	= psTrace->uiNextSample;
+			psTrace->auiPendingTime[psTrace->uiPendingTail]		= uiNow;
+			psTrace->uiPendingTail								= TRACE_NEXT(psTrace->uiPendingTail);
+		}
+
+		psTrace->uiNextSample += RING_BUFFER_TRACE_INTERVAL;
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Record the residency of the sampled elements just popped
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	Called with the buffer locked, through BUFFER_TRACE_POPPED, only when a sampled element
+//				was popped
+// ---------------------------------------------------------------------------------------------------
+void BufferTracePopped(SRingBuffer* psRingBuffer)
+{
+	SBufferTrace*	psTrace	= &psRingBuffer->sTrace;
+	UINT64			uiNow	= BufferNow();
+
+	while ((psTrace->uiPendingHead != psTrace->uiPendingTail) &&
+		   (psTrace->auiPendingSequence[psTrace->uiPendingHead] < psTrace->uiPopTotal))
+	{
+		psTrace->auiHistogram[BufferTraceBucket(uiNow - psTrace->auiPendingTime[psTrace->uiPendingHead])]++;
+		psTrace->uiSampleCount++;
+		psTrace->uiPendingHead = TRACE_NEXT(psTrace->uiPendingHead);
+	}
+}
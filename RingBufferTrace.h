@@ -0,0 +1,59 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferTrace.h
+// 	Brief 		: 	Sampled queue-residency tracing of the ring buffer. Every Nth pushed element gets a
+//					monotonic timestamp in side storage, and the pop which releases it records the time
+//					it stayed queued into a log-linear (HDR style) histogram. The data format is not
+//					changed
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_TRACE_INTERVAL to be greater than 0
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_TRACE_H_
+#define _RING_BUFFER_TRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+// Snapshot of the queue-residency tracing of a ring buffer
+typedef struct S_BUFFER_TRACE_STATS
+{
+	UINT64					uiSampleCount;				// Samples recorded into the histogram
+	UINT64					uiDropCount;				// Samples dropped, all slots were in use
+	UINT64					auiHistogram[BUFFER_TRACE_BUCKETS];	// Histogram of the residency in ns
+
+} SBufferTraceStats;
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+void			BufferTraceSnapshot(SRingBuffer* psRingBuffer, SBufferTraceStats* psStats);
+void			BufferTraceReset(SRingBuffer* psRingBuffer);
+UINT64			BufferTracePercentile(SBufferTraceStats* psStats, double dPercentile);
+UINT16			BufferTraceBucket(UINT64 uiNanoseconds);
+UINT64			BufferTraceBucketValue(UINT16 uiBucket);
+
+void			BufferTracePushed(SRingBuffer* psRingBuffer);
+void			BufferTracePopped(SRingBuffer* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_TRACE_H_
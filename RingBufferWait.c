@@ -0,0 +1,287 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferWait.c
+// 	Brief 		: 	Blocking and timed pushing/popping for the ring buffer. A waiting caller spins
+//					briefly, then parks on a futex. The other side only makes a system call when
+//					somebody is actually parked
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_WAIT to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+// 	1.01  	AnhNH57  	17-10-2026 	Pop until uiMinLength, poll without the lock, no spin for timeout 0
+// 	1.02  	AnhNH57  	17-10-2026 	Move the clock and the spin hint to RingBufferInternal.h
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "RingBufferWait.h"
+#include "RingBufferInternal.h"
+
+#if (RING_BUFFER_ENABLE_WAIT != 1)
+	#error "RingBufferWait.c requires RING_BUFFER_ENABLE_WAIT to be set to 1"
+#endif
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+static BOOL		BufferWaitReady(SRingBuffer* psRingBuffer, BOOL bPushSide, BUFFER_INDEX uiLength);
+static BOOL		BufferWaitFor(SRingBuffer* psRingBuffer, BOOL bPushSide, BUFFER_INDEX uiLength, INT64 iDeadline);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+///////////////////////////////////// Function implements ////////////////////////////////////////////
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a data element into ring buffer, waiting for room if the buffer is full
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data to be pushed into the buffer
+//	@param	: 	iTimeoutMs is the maximum waiting time in millisecond, 0 does not wait and
+//				BUFFER_WAIT_FOREVER waits until pushing succeeds
+//	@return	: 	TRUE if pushing successfully, FALSE if timed out
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferPushWait(SRingBuffer* psRingBuffer, void* pvData, INT32 iTimeoutMs)
+{
+	return BufferPushStreamWait(psRingBuffer, pvData, 1, iTimeoutMs);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop out a data element from ring buffer, waiting for data if the buffer is empty
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvData is the data is popped out of the buffer
+//	@param	: 	iTimeoutMs is the maximum waiting time in millisecond, 0 does not wait and
+//				BUFFER_WAIT_FOREVER waits until popping succeeds
+//	@return	: 	The number of elements popped out actually, 0 if timed out
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPopWait(SRingBuffer* psRingBuffer, void* pvData, INT32 iTimeoutMs)
+{
+	return BufferPopStreamWait(psRingBuffer, pvData, 1, 1, iTimeoutMs);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Push a stream into ring buffer, waiting until there is room for the whole stream
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be pushed into the buffer
+//	@param	:	uiLength is the length of data stream
+//	@param	: 	iTimeoutMs is the maximum waiting time in millisecond, 0 does not wait and
+//				BUFFER_WAIT_FOREVER waits until pushing succeeds
+//	@return	: 	TRUE if pushing successfully, FALSE if timed out
+//	@note	:	A stream longer than the buffer size can never be pushed and fails immediately
+// ---------------------------------------------------------------------------------------------------
+BOOL BufferPushStreamWait(SRingBuffer* psRingBuffer, void* pvStream, BUFFER_INDEX uiLength, INT32 iTimeoutMs)
+{
+	INT64	iDeadline	= (iTimeoutMs < 0) ? -1 : ((INT64)BufferNow() + (INT64)iTimeoutMs * 1000000);
+
+	if (uiLength > psRingBuffer->uiBufferSize)
+	{
+		return FALSE;
+	}
+
+	if (iTimeoutMs == 0)
+	{
+		return BufferPushStream(psRingBuffer, pvStream, uiLength);
+	}
+
+	while (BufferPushStream(psRingBuffer, pvStream, uiLength) == FALSE)
+	{
+		if (BufferWaitFor(psRingBuffer, TRUE, uiLength, iDeadline) == FALSE)
+		{
+			return FALSE;	// Timed out
+		}
+	}
+
+	return TRUE;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Pop a stream from ring buffer, waiting until there are at least uiMinLength elements
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	pvStream is the data stream to be popped out from the buffer
+//	@param	:	uiLength is the length of data stream
+//	@param	:	uiMinLength is the element count to wait for, so that the caller can pop in batches
+//	@param	: 	iTimeoutMs is the maximum waiting time in millisecond, 0 does not wait and
+//				BUFFER_WAIT_FOREVER waits until uiMinLength elements are available
+//	@return	: 	The number of elements popped out actually. When the deadline passes, the elements
+//				available at that time are popped out, even if they are less than uiMinLength
+//	@note	:	The elements may be popped in several parts while other consumers share the buffer
+// ---------------------------------------------------------------------------------------------------
+BUFFER_INDEX BufferPopStreamWait(SRingBuffer* psRingBuffer,
+								 void* pvStream,
+								 BUFFER_INDEX uiLength,
+								 BUFFER_INDEX uiMinLength,
+								 INT32 iTimeoutMs)
+{
+	INT64			iDeadline	= (iTimeoutMs < 0) ? -1 : ((INT64)BufferNow() + (INT64)iTimeoutMs * 1000000);
+	BUFFER_INDEX	uiPopCount	= 0;
+
+	if (iTimeoutMs == 0)
+	{
+		return BufferPopStream(psRingBuffer, pvStream, uiLength);
+	}
+
+	// Never wait for more than can be popped at once or can be held by the buffer
+	if (uiMinLength > uiLength)
+	{
+		uiMinLength = uiLength;
+	}
+	if (uiMinLength > psRingBuffer->uiBufferSize)
+	{
+		uiMinLength = psRingBuffer->uiBufferSize;
+	}
+
+	for (;;)
+	{
+		uiPopCount += BufferPopStream(psRingBuffer,
+									  (UCHAR*)pvStream + (size_t)uiPopCount * psRingBuffer->uiElementSize,
+									  uiLength - uiPopCount);
+		if (uiPopCount >= uiMinLength)
+		{
+			break;
+		}
+
+		if (BufferWaitFor(psRingBuffer, FALSE, uiMinLength - uiPopCount, iDeadline) == FALSE)
+		{
+			// Timed out, take what is there
+			uiPopCount += BufferPopStream(psRingBuffer,
+										  (UCHAR*)pvStream + (size_t)uiPopCount * psRingBuffer->uiElementSize,
+										  uiLength - uiPopCount);
+			break;
+		}
+	}
+
+	return uiPopCount;
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Wake every caller blocked on pushing into the ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	Called through BUFFER_WAKE_PUSH_WAITERS, which skips it when nobody is parked
+// ---------------------------------------------------------------------------------------------------
+void BufferWakePushWaiters(SRingBuffer* psRingBuffer)
+{
+	__atomic_add_fetch(&psRingBuffer->iPushFutex, 1, __ATOMIC_SEQ_CST);
+	syscall(SYS_futex, &psRingBuffer->iPushFutex, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Wake every caller blocked on popping from the ring buffer
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@return	: 	Void
+//	@note	:	Called through BUFFER_WAKE_POP_WAITERS, which skips it when nobody is parked
+// ---------------------------------------------------------------------------------------------------
+void BufferWakePopWaiters(SRingBuffer* psRingBuffer)
+{
+	__atomic_add_fetch(&psRingBuffer->iPopFutex, 1, __ATOMIC_SEQ_CST);
+	syscall(SYS_futex, &psRingBuffer->iPopFutex, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Check if the ring buffer can satisfy a waiting caller
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	bPushSide is TRUE for a pushing caller and FALSE for a popping caller
+//	@param	:	uiLength is the number of free (pushing) or occupied (popping) elements needed
+//	@return	: 	TRUE if the caller can proceed and vice versa
+//	@note	:	Polled while spinning, so the buffer is not locked
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferWaitReady(SRingBuffer* psRingBuffer, BOOL bPushSide, BUFFER_INDEX uiLength)
+{
+	if (bPushSide == TRUE)
+	{
+		return (psRingBuffer->bBufferPushEnable == TRUE) && (psRingBuffer->bBufferReserved == FALSE) &&
+			   (BufferGetAvailableCountUnlocked(psRingBuffer) >= uiLength);
+	}
+
+	return (psRingBuffer->bBufferPopEnable == TRUE) && (BufferGetCount(psRingBuffer) >= uiLength);
+}
+
+// ---------------------------------------------------------------------------------------------------
+//	@brief	: 	Wait until the ring buffer can satisfy a caller or the deadline passes. The caller
+//				spins for RING_BUFFER_WAIT_SPIN_COUNT checks first, then parks on the futex
+//
+//	@param	: 	psRingBuffer is the structure of the ring buffer
+//	@param	: 	bPushSide is TRUE for a pushing caller and FALSE for a popping caller
+//	@param	:	uiLength is the number of free (pushing) or occupied (popping) elements needed
+//	@param	:	iDeadline is the monotonic deadline in nanosecond, negative for no deadline
+//	@return	: 	TRUE if the caller can proceed, FALSE if the deadline passed
+//	@note	:
+// ---------------------------------------------------------------------------------------------------
+static BOOL BufferWaitFor(SRingBuffer* psRingBuffer, BOOL bPushSide, BUFFER_INDEX uiLength, INT64 iDeadline)
+{
+	int*			piFutex		= (bPushSide == TRUE) ? &psRingBuffer->iPushFutex : &psRingBuffer->iPopFutex;
+	int*			piWaiters	= (bPushSide == TRUE) ? &psRingBuffer->iPushWaiters : &psRingBuffer->iPopWaiters;
+	int				iSequence	= 0;
+	INT64			iRemain		= 0;
+	UINT16			uiSpin		= 0;
+	BOOL			bReady		= FALSE;
+	struct timespec	sTimeout;
+
+	// Spin briefly, the other side is often just about to finish its operation
+	for (uiSpin = 0; uiSpin < RING_BUFFER_WAIT_SPIN_COUNT; uiSpin++)
+	{
+		if (BufferWaitReady(psRingBuffer, bPushSide, uiLength) == TRUE)
+		{
+			return TRUE;
+		}
+		BUFFER_CPU_RELAX();
+	}
+
+	for (;;)
+	{
+		// Take the futex sequence, announce the waiter, then re-check the buffer. A change made by the
+		// other side after the check bumps the sequence, so the futex wait below returns at once
+		iSequence = __atomic_load_n(piFutex, __ATOMIC_SEQ_CST);
+		__atomic_add_fetch(piWaiters, 1, __ATOMIC_SEQ_CST);
+
+		bReady = BufferWaitReady(psRingBuffer, bPushSide, uiLength);
+		if (bReady == FALSE)
+		{
+			if (iDeadline < 0)
+			{
+				syscall(SYS_futex, piFutex, FUTEX_WAIT_PRIVATE, iSequence, NULL, NULL, 0);
+			}
+			else
+			{
+				iRemain = iDeadline - (INT64)BufferNow();
+				if (iRemain > 0)
+				{
+					sTimeout.tv_sec		= (time_t)(iRemain / 1000000000);
+					sTimeout.tv_nsec	= (long)(iRemain % 1000000000);
+					syscall(SYS_futex, piFutex, FUTEX_WAIT_PRIVATE, iSequence, &sTimeout, NULL, 0);
+				}
+			}
+		}
+
+		__atomic_sub_fetch(piWaiters, 1, __ATOMIC_SEQ_CST);
+
+		if ((bReady == TRUE) || (BufferWaitReady(psRingBuffer, bPushSide, uiLength) == TRUE))
+		{
+			return TRUE;
+		}
+
+		if ((iDeadline >= 0) && ((INT64)BufferNow() >= iDeadline))
+		{
+			return FALSE;	// Timed out
+		}
+	}
+}
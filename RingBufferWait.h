@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	File name	:	RingBufferWait.h
+// 	Brief 		: 	Blocking and timed pushing/popping for the ring buffer. A waiting caller spins
+//					briefly, then parks on a futex. The other side only makes a system call when
+//					somebody is actually parked
+//	Author 		: 	AnhNH57
+//  Note 		: 	Linux only. Requires RING_BUFFER_ENABLE_WAIT to be set to 1
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// 	MODIFICATION HISTORY:
+//
+// 	Ver  	PIC  		Date       	Changes
+// 	----- 	-------- 	---------- 	------------------------------------------------------------------
+// 	1.00  	AnhNH57  	17-10-2026 	Create Framework
+//
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _RING_BUFFER_WAIT_H_
+#define _RING_BUFFER_WAIT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+////////////////////////////////////////// Include Files /////////////////////////////////////////////
+#include "RingBuffer.h"
+
+///////////////////////////////////// Constant Definitions ///////////////////////////////////////////
+// Timeout value meaning "wait until the operation succeeds"
+#define BUFFER_WAIT_FOREVER			(-1)
+
+/////////////////////////////////////// Type Definitions /////////////////////////////////////////////
+
+///////////////////////////// Macros (Inline Functions) Definitions //////////////////////////////////
+// Wake the callers blocked on pushing (resp. popping), if there are any. The fence pairs with the one
+// taken by a waiter between announcing itself and re-checking the buffer, so either the waiter sees
+// the new state or the waker sees the waiter
+#define BUFFER_WAKE_PUSH_WAITERS(ps)																\
+			do																						\
+			{																						\
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);											\
+				if (__atomic_load_n(&(ps)->iPushWaiters, __ATOMIC_RELAXED) != 0)					\
+				{																					\
+					BufferWakePushWaiters(ps);														\
+				}																					\
+			} while (0)
+
+#define BUFFER_WAKE_POP_WAITERS(ps)																	\
+			do																						\
+			{																						\
+				__atomic_thread_fence(__ATOMIC_SEQ_CST);											\
+				if (__atomic_load_n(&(ps)->iPopWaiters, __ATOMIC_RELAXED) != 0)						\
+				{																					\
+					BufferWakePopWaiters(ps);														\
+				}																					\
+			} while (0)
+
+///////////////////////////////////// Function Prototypes ////////////////////////////////////////////
+BOOL			BufferPushWait(SRingBuffer* psRingBuffer, void* pvData, INT32 iTimeoutMs);
+BUFFER_INDEX	BufferPopWait(SRingBuffer* psRingBuffer, void* pvData, INT32 iTimeoutMs);
+BOOL			BufferPushStreamWait(SRingBuffer* psRingBuffer, void* pvStream, BUFFER_INDEX uiLength, INT32 iTimeoutMs);
+BUFFER_INDEX	BufferPopStreamWait(SRingBuffer* psRingBuffer,
+									void* pvStream,
+									BUFFER_INDEX uiLength,
+									BUFFER_INDEX uiMinLength,
+									INT32 iTimeoutMs);
+
+void			BufferWakePushWaiters(SRingBuffer* psRingBuffer);
+void			BufferWakePopWaiters(SRingBuffer* psRingBuffer);
+
+///////////////////////////////////// Variable Definitions ///////////////////////////////////////////
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// _RING_BUFFER_WAIT_H_